@@ -34,6 +34,9 @@
 #define OP_SHUTDOWN    12
 #define OP_DISPLAYTEST 15
 
+// Single-bit masks, cheaper than a variable shift on AVR
+static const byte BIT_MASK[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+
 Max72xxPanel::Max72xxPanel(byte csPin, byte hDisplays, byte vDisplays) : Adafruit_GFX(hDisplays << 3, vDisplays << 3) {
 
   Max72xxPanel::SPI_CS = csPin;
@@ -45,19 +48,34 @@ Max72xxPanel::Max72xxPanel(byte csPin, byte hDisplays, byte vDisplays) : Adafrui
   Max72xxPanel::bitmap = (byte*)malloc(bitmapSize);
   Max72xxPanel::matrixRotation = (byte*)malloc(displays);
   Max72xxPanel::matrixPosition = (byte*)malloc(displays);
+  Max72xxPanel::cellOffset = (byte*)malloc(displays);
+  Max72xxPanel::cellRotation = (byte*)malloc(displays);
+
+  greyPlanes = 0;
+  greyActive = false;
+  greySlot = 0;
+  frontDirtyRows = 0;
+  frontGreyRows = 0;
 
   for ( byte display = 0; display < displays; display++ ) {
   	matrixPosition[display] = display;
   	matrixRotation[display] = 0;
   }
+  updateLayout();
 
   SPI.begin();
 //SPI.setBitOrder(MSBFIRST);
 //SPI.setDataMode(SPI_MODE0);
   pinMode(SPI_CS, OUTPUT);
 
-  // Clear the screen
+  // Clear the screen, and make sure the first write() sends every row as
+  // we don't know what the displays are showing at power up
   fillScreen(0);
+  dirtyRows = 0xff;
+
+#if MAX72XX_PROFILING
+  resetProfile();
+#endif
 
   // Make sure we are not in test mode
   spiTransfer(OP_DISPLAYTEST, 0);
@@ -77,10 +95,35 @@ Max72xxPanel::Max72xxPanel(byte csPin, byte hDisplays, byte vDisplays) : Adafrui
 
 void Max72xxPanel::setPosition(byte display, byte x, byte y) {
 	matrixPosition[x + hDisplays * y] = display;
+	updateLayout();
 }
 
 void Max72xxPanel::setRotation(byte display, byte rotation) {
 	matrixRotation[display] = rotation;
+	updateLayout();
+}
+
+void Max72xxPanel::updateLayout() {
+	// Resolve, for every 8x8 cell of the canvas, which display shows it:
+	// the display's first byte in the bitmap buffer and its rotation.
+	// drawPixel() then needs no division or multiplication.
+
+	for ( byte cell = 0; cell < (bitmapSize >> 3); cell++ ) {
+		byte display = matrixPosition[cell];
+		byte d = display / hDisplays;
+		cellOffset[cell] = ((display - d * hDisplays) << 3) + WIDTH * d;
+		cellRotation[cell] = matrixRotation[display];
+	}
+
+	// scrollLeft() can shift whole bytes when every display of the top
+	// row is rotated by 90 or 270 degrees the same way (canvas rows are
+	// then bytes in the bitmap buffer)
+	topRowRotation = cellRotation[0];
+	for ( byte cell = 1; cell < hDisplays; cell++ ) {
+		if ( cellRotation[cell] != topRowRotation ) {
+			topRowRotation = 0xff;
+		}
+	}
 }
 
 void Max72xxPanel::setRotation(uint8_t rotation) {
@@ -96,10 +139,50 @@ void Max72xxPanel::setIntensity(byte intensity) {
 }
 
 void Max72xxPanel::fillScreen(uint16_t color) {
-  memset(bitmap, color ? 0xff : 0, bitmapSize);
+  byte val = color ? 0xff : 0;
+
+  for ( byte i = 0; i < bitmapSize; i++ ) {
+    if ( bitmap[i] != val ) {
+      bitmap[i] = val;
+      dirtyRows |= 1 << (i & 0b111);
+    }
+  }
+
+  if ( greyActive ) {
+    // Both planes lit (full level) or both blank
+    for ( byte i = 0; i < bitmapSize; i++ ) {
+      if ( greyPlanes[i] != val ) {
+        greyPlanes[i] = val;
+        dirtyRows |= 1 << (i & 0b111);
+      }
+    }
+  }
 }
 
 void Max72xxPanel::drawPixel(int16_t xx, int16_t yy, uint16_t color) {
+	byte cell, lx, ly;
+
+	if ( canvasPixel(xx, yy, cell, lx, ly) ) {
+		setCellPixel(cell, lx, ly, color != 0);
+	}
+}
+
+void Max72xxPanel::drawGreyPixel(int16_t x, int16_t y, byte level) {
+	byte cell, lx, ly;
+
+	if ( !canvasPixel(x, y, cell, lx, ly) ) {
+		return;
+	}
+
+	if ( greyActive ) {
+		setCellLevel(cell, lx, ly, level);
+	}
+	else {
+		setCellPixel(cell, lx, ly, level != 0);
+	}
+}
+
+boolean Max72xxPanel::canvasPixel(int16_t xx, int16_t yy, byte &cell, byte &lx, byte &ly) {
 	// Operating in bytes is faster and takes less code to run. We don't
 	// need values above 200, so switch from 16 bit ints to 8 bit unsigned
 	// ints (bytes).
@@ -125,71 +208,336 @@ void Max72xxPanel::drawPixel(int16_t xx, int16_t yy, uint16_t color) {
 
 	if ( x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT ) {
 		// Ignore pixels outside the canvas.
+		return false;
+	}
+
+	cell = (x >> 3) + hDisplays * (y >> 3);
+	lx = x & 0b111;
+	ly = y & 0b111;
+	return true;
+}
+
+void Max72xxPanel::drawColumn(int16_t x, byte column) {
+	if ( x < 0 || x >= WIDTH ) {
 		return;
 	}
 
-	// Translate the x, y coordinate according to the layout of the
-	// displays. They can be ordered and rotated (0, 90, 180, 270).
+	byte cell = x >> 3;
+	byte lx = x & 0b111;
+	for ( byte ly = 0; ly < 8; ly++ ) {
+		setCellPixel(cell, lx, ly, column & BIT_MASK[ly]);
+	}
+}
 
-	byte display = matrixPosition[(x >> 3) + hDisplays * (y >> 3)];
-	x &= 0b111;
-	y &= 0b111;
+void Max72xxPanel::blitColumns(int16_t x, const byte *columns, int16_t count) {
+	// Clip to the canvas, then draw column by column.
+	int16_t first = x < 0 ? -x : 0;
+	int16_t last = WIDTH - x < count ? WIDTH - x : count;
 
-	byte r = matrixRotation[display];
-	if ( r >= 2 ) {										   // 180 or 270 degrees
-		x = 7 - x;
+	for ( int16_t i = first; i < last; i++ ) {
+		drawColumn(x + i, columns[i]);
 	}
-	if ( r == 1 || r == 2 ) {				     // 90 or 180 degrees
-		y = 7 - y;
+}
+
+void Max72xxPanel::scrollLeft(byte newColumn) {
+	if ( topRowRotation == 1 || topRowRotation == 3 ) {
+		// Row ly of a cell is one byte with column lx in bit lx (90 degrees)
+		// or bit 7 - lx (270 degrees). Shift every byte by one bit and carry
+		// in the leftmost pixel of the cell to the right.
+		for ( byte ly = 0; ly < 8; ly++ ) {
+			byte row = topRowRotation == 1 ? 7 - ly : ly;
+			byte incoming = (newColumn & BIT_MASK[ly]) ? 1 : 0;
+
+			for ( int8_t cell = hDisplays - 1; cell >= 0; cell-- ) {
+				byte *ptr = bitmap + cellOffset[cell] + row;
+				byte old = *ptr;
+				byte outgoing;
+
+				if ( topRowRotation == 1 ) {
+					outgoing = old & 0x01;
+					*ptr = (old >> 1) | (incoming << 7);
+				}
+				else {
+					outgoing = old >> 7;
+					*ptr = (old << 1) | incoming;
+				}
+
+				if ( *ptr != old ) {
+					dirtyRows |= BIT_MASK[row];
+				}
+				incoming = outgoing;
+			}
+		}
+		return;
 	}
-	if ( r & 1 ) {     								   // 90 or 270 degrees
-		tmp = x; x = y; y = tmp;
+
+	// Mixed or unrotated layouts: move the columns one by one
+	for ( int16_t x = 0; x < WIDTH - 1; x++ ) {
+		drawColumn(x, getColumn(x + 1));
 	}
+	drawColumn(WIDTH - 1, newColumn);
+}
 
-	byte d = display / hDisplays;
-	x += (display - d * hDisplays) << 3; // x += (display % hDisplays) * 8
-	y += d << 3;												 // y += (display / hDisplays) * 8
+byte Max72xxPanel::getColumn(int16_t x) {
+	byte cell = x >> 3;
+	byte lx = x & 0b111;
+	byte column = 0;
+
+	for ( byte ly = 0; ly < 8; ly++ ) {
+		byte row, bit;
+		mapCellPixel(cellRotation[cell], lx, ly, row, bit);
+		if ( bitmap[cellOffset[cell] + row] & BIT_MASK[bit] ) {
+			column |= BIT_MASK[ly];
+		}
+	}
+	return column;
+}
+
+void Max72xxPanel::mapCellPixel(byte rotation, byte lx, byte ly, byte &row, byte &bit) {
+	// Digit row (column within the display) and segment bit after rotation
+	switch ( rotation ) {
+		case 1:  row = 7 - ly; bit = lx;     break;  // 90 degrees
+		case 2:  row = 7 - lx; bit = 7 - ly; break;  // 180 degrees
+		case 3:  row = ly;     bit = 7 - lx; break;  // 270 degrees
+		default: row = lx;     bit = ly;     break;
+	}
+}
+
+void Max72xxPanel::setCellPixel(byte cell, byte lx, byte ly, byte on) {
+	// Translate the cell coordinate according to the layout of the
+	// displays. They can be ordered and rotated (0, 90, 180, 270); the
+	// tables built by updateLayout() hold the result per 8x8 cell.
+
+	byte row, bit;
+	mapCellPixel(cellRotation[cell], lx, ly, row, bit);
 
 	// Update the color bit in our bitmap buffer.
 
-	byte *ptr = bitmap + x + WIDTH * (y >> 3);
-	byte val = 1 << (y & 0b111);
+	byte *ptr = bitmap + cellOffset[cell] + row;
+	byte val = BIT_MASK[bit];
+	byte old = *ptr;
 
-	if ( color ) {
+	if ( on ) {
 		*ptr |= val;
 	}
 	else {
 		*ptr &= ~val;
 	}
+
+	if ( *ptr != old ) {
+		dirtyRows |= BIT_MASK[row];
+	}
+
+	if ( greyActive ) {
+		// Plain drawing is at full level: keep the low plane in step
+		setCellLevel(cell, lx, ly, on ? GREY_MAX_LEVEL : 0);
+	}
+}
+
+void Max72xxPanel::setCellLevel(byte cell, byte lx, byte ly, byte level) {
+	// Level bit 1 lives in the high plane (bitmap), bit 0 in the low plane.
+
+	byte row, bit;
+	mapCellPixel(cellRotation[cell], lx, ly, row, bit);
+
+	byte offset = cellOffset[cell] + row;
+	byte val = BIT_MASK[bit];
+	byte oldHigh = bitmap[offset];
+	byte oldLow = greyPlanes[offset];
+
+	bitmap[offset] = (level & 2) ? oldHigh | val : oldHigh & ~val;
+	greyPlanes[offset] = (level & 1) ? oldLow | val : oldLow & ~val;
+
+	if ( bitmap[offset] != oldHigh || greyPlanes[offset] != oldLow ) {
+		dirtyRows |= BIT_MASK[row];
+	}
 }
 
 void Max72xxPanel::write() {
-	// Send the bitmap buffer to the displays.
+	// Send the changed rows of the bitmap buffer to the displays.
+
+	if ( !dirtyRows ) {
+		return;
+	}
+
+	if ( greyActive ) {
+		// Hand the finished frame to refreshGreyscale(), which owns the SPI
+		// bus while greyscale is on
+		byte greyRows = 0;
+		for ( byte i = 0; i < bitmapSize; i++ ) {
+			if ( bitmap[i] != greyPlanes[i] ) {
+				greyRows |= BIT_MASK[i & 0b111];
+			}
+		}
+
+		noInterrupts();
+		memcpy(greyPlanes + bitmapSize, bitmap, bitmapSize);
+		memcpy(greyPlanes + 2 * bitmapSize, greyPlanes, bitmapSize);
+		frontDirtyRows |= dirtyRows;
+		frontGreyRows = greyRows;
+		interrupts();
+	}
+	else {
+		sendRows(dirtyRows, bitmap);
+	}
+
+	dirtyRows = 0;
+
+#if MAX72XX_PROFILING
+	writeCount++;
+#endif
+}
+
+boolean Max72xxPanel::setGreyscale(boolean enabled) {
+	if ( enabled == greyActive ) {
+		return true;
+	}
+
+	if ( enabled ) {
+		if ( !greyPlanes ) {
+			greyPlanes = (byte*)malloc(3 * bitmapSize);
+			if ( !greyPlanes ) {
+				return false;
+			}
+		}
+
+		// Every lit pixel starts at full level; the interrupt sends the
+		// whole frame on its first slot
+		memcpy(greyPlanes, bitmap, bitmapSize);
+		memcpy(greyPlanes + bitmapSize, bitmap, bitmapSize);
+		memcpy(greyPlanes + 2 * bitmapSize, bitmap, bitmapSize);
+		dirtyRows = 0;
+
+		noInterrupts();
+		frontDirtyRows = 0xff;
+		frontGreyRows = 0;
+		greySlot = 0;
+		greyActive = true;
+		interrupts();
+	}
+	else {
+		noInterrupts();
+		greyActive = false;
+		interrupts();
+
+		// Back to on/off: show every lit pixel, whatever its level
+		for ( byte i = 0; i < bitmapSize; i++ ) {
+			bitmap[i] |= greyPlanes[i];
+		}
+		forceFullWrite();
+	}
+	return true;
+}
+
+void Max72xxPanel::refreshGreyscale() {
+	// Binary weighted time slots: the high plane (weight 2) is shown for
+	// slots 0 and 1, the low plane (weight 1) for slot 2. Rows only need
+	// to be resent when the frame changed, or when the shown plane changes
+	// on a row where the two planes differ.
 
-	for ( byte row = OP_DIGIT7; row >= OP_DIGIT0; row-- ) {
-		spiTransfer(row);
+	if ( !greyActive ) {
+		return;
 	}
+
+	greySlot = greySlot >= 2 ? 0 : greySlot + 1;
+	byte rows = frontDirtyRows;
+	if ( greySlot != 1 ) {
+		rows |= frontGreyRows;
+	}
+	frontDirtyRows = 0;
+
+	sendRows(rows, greyPlanes + (greySlot < 2 ? bitmapSize : 2 * bitmapSize));
+}
+
+#if MAX72XX_PROFILING
+unsigned long Max72xxPanel::getSpiMicros() {
+	noInterrupts();
+	unsigned long total = spiMicros;
+	interrupts();
+	return total;
+}
+
+void Max72xxPanel::resetProfile() {
+	noInterrupts();
+	spiMicros = 0;
+	interrupts();
+	writeCount = 0;
+}
+#endif
+
+void Max72xxPanel::forceFullWrite() {
+	dirtyRows = 0xff;
+	write();
 }
 
 void Max72xxPanel::spiTransfer(byte opcode, byte data) {
-	// If opcode > OP_DIGIT7, send the opcode and data to all displays.
-	// If opcode <= OP_DIGIT7, display the column with data in our buffer for all displays.
-	// We do not support (nor need) to use the OP_NOOP opcode.
+	// Send the opcode and data to all displays. Display rows are sent by
+	// sendRows() instead. We do not support (nor need) to use the OP_NOOP
+	// opcode.
+
+	// Commands must not interleave with the greyscale interrupt's rows
+	boolean guard = greyActive;
+	if ( guard ) {
+		noInterrupts();
+	}
+
+#if MAX72XX_PROFILING
+	unsigned long startMicros = micros();
+#endif
 
 	// Enable the line
 	digitalWrite(SPI_CS, LOW);
 
 	// Now shift out the data, two bytes per display. The first byte is the opcode,
 	// the second byte the data.
-	byte end = opcode - OP_DIGIT0;
-	byte start = bitmapSize + end;
-	do {
-		start -= 8;
+	for ( byte i = 0; i < bitmapSize; i += 8 ) {
 		SPI.transfer(opcode);
-		SPI.transfer(opcode <= OP_DIGIT7 ? bitmap[start] : data);
+		SPI.transfer(data);
 	}
-	while ( start > end );
 
 	// Latch the data onto the display(s)
 	digitalWrite(SPI_CS, HIGH);
+
+#if MAX72XX_PROFILING
+	spiMicros += micros() - startMicros;
+#endif
+
+	if ( guard ) {
+		interrupts();
+	}
+}
+
+void Max72xxPanel::sendRows(byte rows, const byte *plane) {
+	// Display the rows set in rows with the data in plane for all displays.
+
+#if MAX72XX_PROFILING
+	unsigned long startMicros = micros();
+#endif
+
+	for ( int8_t row = 7; row >= 0; row-- ) {
+		if ( !(rows & BIT_MASK[row]) ) {
+			continue;
+		}
+
+		// Enable the line
+		digitalWrite(SPI_CS, LOW);
+
+		// Two bytes per display, the farthest display first: the opcode,
+		// then the display's byte for this row
+		byte opcode = OP_DIGIT0 + row;
+		byte start = bitmapSize + row;
+		do {
+			start -= 8;
+			SPI.transfer(opcode);
+			SPI.transfer(plane[start]);
+		}
+		while ( start > row );
+
+		// Latch the data onto the display(s)
+		digitalWrite(SPI_CS, HIGH);
+	}
+
+#if MAX72XX_PROFILING
+	spiMicros += micros() - startMicros;
+#endif
 }
@@ -21,6 +21,13 @@
 #ifndef Max72xxPanel_h
 #define Max72xxPanel_h
 
+/* SPI timing counters, enabled by building with -D ENABLE_PROFILING=1 */
+#if defined(ENABLE_PROFILING) && ENABLE_PROFILING
+  #define MAX72XX_PROFILING 1
+#else
+  #define MAX72XX_PROFILING 0
+#endif
+
 #if (ARDUINO >= 100)
   #include <Arduino.h>
 #else
@@ -71,6 +78,33 @@ public:
    */
   void drawPixel(int16_t x, int16_t y, uint16_t color);
 
+  /*
+   * Draw one 8 pixel column of the top display row at once. Bit 0 is
+   * the top pixel (y = 0). Like drawPixel(), only the bitmap buffer is
+   * modified. Canvas coordinates are used; setRotation(byte) (Adafruit's
+   * rotation) is not applied.
+   * Paramaters:
+   * x		column on the canvas, columns outside it are ignored
+   * column	pixel bits, bit 0 at the top
+   */
+  void drawColumn(int16_t x, byte column);
+
+  /*
+   * Draw count columns from the columns array, starting at column x.
+   * Columns that fall outside the canvas are skipped, so x may be
+   * negative (e.g. for a scrolling strip of pre-rendered text).
+   */
+  void blitColumns(int16_t x, const byte *columns, int16_t count);
+
+  /*
+   * Shift the top display row one column to the left in place and
+   * insert newColumn (bit 0 at the top) at the right edge. For a
+   * marquee only one new column enters per frame, so this is much
+   * cheaper than redrawing. When all displays of the top row share a
+   * 90 or 270 degree rotation, whole bitmap bytes are shifted.
+   */
+  void scrollLeft(byte newColumn);
+
   /*
    * As we can do this much faster then setting all the pixels one by
    * one, we have a dedicated function to clear the screen.
@@ -95,23 +129,124 @@ public:
 
   /*
    * After you're done filling the bitmap buffer with your picture,
-   * send it to the display(s).
+   * send it to the display(s). Only the rows that changed since the
+   * previous write() are shifted out.
    */
   void write();
 
+  /*
+   * Send the whole bitmap buffer to the display(s), regardless of which
+   * rows changed. Use this to recover from a display that lost its
+   * state (e.g. after a brown-out or a glitch on the SPI lines).
+   */
+  void forceFullWrite();
+
+  /*
+   * Grey levels, shown by time slicing two bitplanes. The MAX7219 only
+   * has a global intensity, so refreshGreyscale() has to be called from a
+   * timer interrupt (every 1-2 ms): it shows the high plane for two slots
+   * and the low plane for one, giving levels 0 (off) to GREY_MAX_LEVEL.
+   * While greyscale is on, write() only hands the finished frame to the
+   * interrupt, so no SPI traffic happens outside of it.
+   * drawPixel(), drawColumn() and fillScreen() draw at full level;
+   * scrollLeft() only shifts the high plane.
+   */
+  static const byte GREY_MAX_LEVEL = 3;
+  /*
+   * Turn greyscale on or off. The first call allocates the extra planes
+   * (3 bytes per display row); returns false if that failed. Lit pixels
+   * keep showing; turning it off shows every lit pixel at full level.
+   */
+  boolean setGreyscale(boolean enabled);
+  boolean isGreyscale() { return greyActive; }
+  /*
+   * Like drawPixel(), with level 0 (off) to GREY_MAX_LEVEL (full). Without
+   * greyscale every level above 0 is drawn fully lit.
+   */
+  void drawGreyPixel(int16_t x, int16_t y, byte level);
+  /*
+   * Show the next time slot of the grey level frame. Call this from a
+   * timer interrupt; does nothing while greyscale is off.
+   */
+  void refreshGreyscale();
+
+#if MAX72XX_PROFILING
+  /*
+   * Profiling counters, only available when built with ENABLE_PROFILING.
+   * getSpiMicros() is the total time spent shifting out data (write() and
+   * commands), getWriteCount() the number of write() calls that sent rows.
+   * With greyscale on the interrupt adds to the SPI time, so it is read
+   * and cleared with interrupts off.
+   */
+  unsigned long getSpiMicros();
+  unsigned long getWriteCount() { return writeCount; }
+  void resetProfile();
+#endif
+
 private:
   byte SPI_CS; /* SPI chip selection */
 
   /* Send out a single command to the device */
   void spiTransfer(byte opcode, byte data=0);
 
+  /* Send the rows set in rows from plane (bitmapSize bytes) to all displays */
+  void sendRows(byte rows, const byte *plane);
+
   /* We keep track of the led-status for 8 devices in this array */
   byte *bitmap;
   byte bitmapSize;
 
+  /* One bit per OP_DIGITx row that needs to be sent on the next write().
+   * All displays share the chip select, so a row is always sent to every
+   * display in the cascade; tracking per display would not save any bytes. */
+  byte dirtyRows;
+
+#if MAX72XX_PROFILING
+  volatile unsigned long spiMicros;
+  unsigned long writeCount;
+#endif
+
   byte hDisplays;
   byte *matrixPosition;
   byte *matrixRotation;
+
+  /* Layout tables, one entry per 8x8 cell of the canvas (rebuilt by
+   * updateLayout() whenever positions or rotations change): the offset of
+   * the display's first byte in bitmap, and the display's rotation. */
+  byte *cellOffset;
+  byte *cellRotation;
+
+  /* Rebuild cellOffset and cellRotation */
+  void updateLayout();
+
+  /* Rotation shared by the top row of displays, 0xff if they differ */
+  byte topRowRotation;
+
+  /* Set or clear pixel (lx, ly) of an 8x8 cell of the canvas */
+  void setCellPixel(byte cell, byte lx, byte ly, byte on);
+
+  /* Resolve canvas pixel (x, y), after Adafruit's rotation, to a cell and
+   * the pixel within it; returns false for pixels outside the canvas */
+  boolean canvasPixel(int16_t x, int16_t y, byte &cell, byte &lx, byte &ly);
+
+  /* Greyscale planes, allocated by the first setGreyscale(true): the low
+   * plane being drawn (bitmap is the high plane), then the high and low
+   * planes of the last finished frame, shown by refreshGreyscale(). */
+  byte *greyPlanes;
+  boolean greyActive;
+  /* Time slot shown by refreshGreyscale() (0, 1: high plane, 2: low) */
+  byte greySlot;
+  /* Rows of the finished frame not yet sent, and rows whose planes differ */
+  byte frontDirtyRows;
+  byte frontGreyRows;
+  /* Set pixel (lx, ly) of a cell on both planes from a grey level */
+  void setCellLevel(byte cell, byte lx, byte ly, byte level);
+
+  /* Read canvas column x of the top display row (bit 0 at the top) */
+  byte getColumn(int16_t x);
+
+  /* Digit row and segment bit of cell pixel (lx, ly) for a display rotation */
+  static void mapCellPixel(byte rotation, byte lx, byte ly, byte &row, byte &bit);
 };
 
 #endif	// Max72xxPanel_h
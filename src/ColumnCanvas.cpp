@@ -0,0 +1,55 @@
+/**
+ * @file ColumnCanvas.cpp
+ * @brief Implementation of the ColumnCanvas class for off-screen text rendering
+ *
+ * This file contains the implementation of the ColumnCanvas class, which
+ * stores Adafruit_GFX drawing output as one byte per 8 pixel column.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "ColumnCanvas.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for ColumnCanvas
+ * @param storage Column storage, one byte per column (not cleared)
+ * @param width Number of columns in storage
+ */
+ColumnCanvas::ColumnCanvas(uint8_t* storage, int16_t width)
+  : Adafruit_GFX(width, 8), columns(storage) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Set or clear one pixel of the canvas
+ * @param x Column (0 to width - 1), others are ignored
+ * @param y Row (0 to 7), others are ignored
+ * @param color Non-zero to set the pixel, zero to clear it
+ */
+void ColumnCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+
+  if (color) {
+    columns[x] |= 1 << y;
+  } else {
+    columns[x] &= ~(1 << y);
+  }
+}
+
+/**
+ * @brief Set or clear every pixel of the canvas
+ * @param color Non-zero to set all pixels, zero to clear them
+ */
+void ColumnCanvas::fillScreen(uint16_t color) {
+  memset(columns, color ? 0xFF : 0x00, _width);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file ColumnCanvas.h
+ * @brief Off-screen Adafruit_GFX canvas stored as 8 pixel columns
+ *
+ * This file contains the ColumnCanvas class, an 8 pixel high drawing surface
+ * that keeps one byte per column. Text printed onto it can be copied to the
+ * LED matrix with Max72xxPanel::blitColumns() without any per-pixel work.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef COLUMN_CANVAS_H
+#define COLUMN_CANVAS_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+// ============================================================================
+// COLUMN CANVAS CLASS
+// ============================================================================
+
+/**
+ * @class ColumnCanvas
+ * @brief 8 pixel high canvas in caller-provided column storage
+ *
+ * Column x is stored in columns[x], bit 0 being the top pixel, which is the
+ * format Max72xxPanel::drawColumn() takes. All Adafruit_GFX drawing
+ * functions (print(), drawChar(), ...) can be used on it.
+ */
+class ColumnCanvas : public Adafruit_GFX {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for ColumnCanvas
+   * @param storage Column storage, one byte per column (not cleared)
+   * @param width Number of columns in storage
+   */
+  ColumnCanvas(uint8_t* storage, int16_t width);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Set or clear one pixel of the canvas
+   * @param x Column (0 to width - 1), others are ignored
+   * @param y Row (0 to 7), others are ignored
+   * @param color Non-zero to set the pixel, zero to clear it
+   */
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+
+  /**
+   * @brief Set or clear every pixel of the canvas
+   * @param color Non-zero to set all pixels, zero to clear them
+   */
+  void fillScreen(uint16_t color) override;
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Column storage, one byte per column */
+  uint8_t* columns;
+};
+
+#endif // COLUMN_CANVAS_H
@@ -0,0 +1,123 @@
+/**
+ * @file DigitSlideAnimation.cpp
+ * @brief Implementation of the DigitSlideAnimation class for time digit transitions
+ *
+ * This file contains the implementation of the DigitSlideAnimation class, which
+ * animates time digit changes with a vertical slide effect without blocking
+ * the main loop.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "DigitSlideAnimation.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for DigitSlideAnimation
+ * @param matrix Reference to the LED matrix display object
+ *
+ * Initializes the animation by deactivating all slide slots.
+ */
+DigitSlideAnimation::DigitSlideAnimation(Max72xxPanel& matrix)
+  : ledMatrix(matrix), activeSlides(0), lastFrameTime(0) {
+  for (int i = 0; i < MAX_DIGIT_SLIDES; i++) {
+    slideArray[i].isActive = false;
+  }
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Start a slide transition for a digit
+ * @param previousChar The character that was previously displayed
+ * @param newChar The new character to display
+ * @param xPosition The X coordinate where the animation occurs
+ *
+ * Reuses the slot already animating this position, otherwise takes a free
+ * slot. When no slide was running, the frame clock is primed so the first
+ * frame is drawn on the next update() call.
+ */
+void DigitSlideAnimation::start(char previousChar, char newChar, int xPosition) {
+  int useIndex = -1;
+
+  for (int slideIndex = 0; slideIndex < MAX_DIGIT_SLIDES; slideIndex++) {
+    if (slideArray[slideIndex].isActive && slideArray[slideIndex].positionX == xPosition) {
+      useIndex = slideIndex;
+      break;
+    }
+    if (!slideArray[slideIndex].isActive && useIndex == -1) {
+      useIndex = slideIndex;
+    }
+  }
+
+  // All slots busy with other positions - should not happen with 4 digits
+  if (useIndex == -1) return;
+
+  if (activeSlides == 0) {
+    lastFrameTime = millis() - SLIDE_FRAME_INTERVAL_MS;
+  }
+
+  if (!slideArray[useIndex].isActive) {
+    activeSlides++;
+  }
+
+  slideArray[useIndex].previousChar = previousChar;
+  slideArray[useIndex].newChar = newChar;
+  slideArray[useIndex].positionX = xPosition;
+  slideArray[useIndex].frameIndex = 0;
+  slideArray[useIndex].isActive = true;
+}
+
+/**
+ * @brief Advance all running slides if the next frame is due
+ *
+ * Each frame draws the new character sliding down from above the display
+ * and the previous character sliding down out of it. A slide finishes after
+ * the frame where the new character reaches y = 0.
+ */
+void DigitSlideAnimation::update() {
+  // Exit early if nothing to animate or frame not due yet
+  if (activeSlides == 0) return;
+
+  unsigned long currentTime = millis();
+  if ((unsigned long)(currentTime - lastFrameTime) < SLIDE_FRAME_INTERVAL_MS) return;
+  lastFrameTime = currentTime;
+
+  int displayHeight = ledMatrix.height();
+
+  for (int slideIndex = 0; slideIndex < MAX_DIGIT_SLIDES; slideIndex++) {
+    DigitSlide& slide = slideArray[slideIndex];
+    if (!slide.isActive) continue;
+
+    int yPosition = slide.frameIndex;
+    // Draw new character sliding up from top
+    ledMatrix.drawChar(slide.positionX, yPosition - displayHeight, slide.newChar, HIGH, LOW, 1);
+    // Draw previous character sliding down
+    ledMatrix.drawChar(slide.positionX, yPosition, slide.previousChar, HIGH, LOW, 1);
+
+    if (++slide.frameIndex > displayHeight) {
+      slide.isActive = false;
+      activeSlides--;
+    }
+  }
+
+  ledMatrix.write();
+}
+
+/**
+ * @brief Stop all running slides without drawing them to completion
+ */
+void DigitSlideAnimation::cancel() {
+  for (int slideIndex = 0; slideIndex < MAX_DIGIT_SLIDES; slideIndex++) {
+    slideArray[slideIndex].isActive = false;
+  }
+  activeSlides = 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file DigitSlideAnimation.h
+ * @brief Non-blocking vertical slide animation for time digits
+ *
+ * This file contains the DigitSlideAnimation class that animates time digit
+ * changes on the LED matrix. The old digit slides down while the new digit
+ * slides in from the top. Frames are scheduled with millis() so the main loop
+ * keeps reading GPS data while an animation is running.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef DIGIT_SLIDE_ANIMATION_H
+#define DIGIT_SLIDE_ANIMATION_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Max72xxPanel.h>
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * @struct DigitSlide
+ * @brief Represents a single digit slide in progress
+ *
+ * This structure holds the characters being swapped, the position of the
+ * digit on the display and how far the slide has progressed.
+ */
+struct DigitSlide {
+  char previousChar;       /**< Character sliding out (downwards) */
+  char newChar;            /**< Character sliding in (from the top) */
+  int positionX;           /**< X coordinate of the digit */
+  uint8_t frameIndex;      /**< Next frame to draw (0 to display height) */
+  bool isActive;           /**< Whether this slide is currently running */
+};
+
+// ============================================================================
+// DIGIT SLIDE ANIMATION CLASS
+// ============================================================================
+
+/**
+ * @class DigitSlideAnimation
+ * @brief Runs the vertical slide transitions of all time digits concurrently
+ *
+ * Slides are started with start() and advanced by update(), which must be
+ * called from the main loop. All running slides share the same frame clock,
+ * so a change on the hour animates all four digits at once and the display
+ * is written only once per frame.
+ *
+ * @note The final frame is identical to the former blocking animation:
+ *       the new character at y = 0 with the previous one pushed off screen
+ */
+class DigitSlideAnimation {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for DigitSlideAnimation
+   * @param matrix Reference to the LED matrix display object
+   */
+  DigitSlideAnimation(Max72xxPanel& matrix);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Start a slide transition for a digit
+   *
+   * If a slide is already running at the same position it is restarted with
+   * the new characters. The first frame is drawn on the next update() call.
+   *
+   * @param previousChar The character that was previously displayed
+   * @param newChar The new character to display
+   * @param xPosition The X coordinate where the animation occurs
+   */
+  void start(char previousChar, char newChar, int xPosition);
+
+  /**
+   * @brief Advance all running slides if the next frame is due
+   *
+   * Draws one frame of every active slide and writes the display once.
+   * Returns immediately when no frame is due.
+   *
+   * @note Call this method every loop iteration
+   */
+  void update();
+
+  /**
+   * @brief Stop all running slides without drawing them to completion
+   *
+   * Used when something else takes over the display (scrolling text,
+   * rain effect).
+   */
+  void cancel();
+
+  /**
+   * @brief Check if any slide is currently running
+   * @return True if at least one slide is active, false otherwise
+   */
+  bool isAnimating() const { return activeSlides > 0; }
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Maximum number of simultaneous slides (HH:MM digits) */
+  static const int MAX_DIGIT_SLIDES = 4;
+
+  /** Time between animation frames (milliseconds) */
+  static const int SLIDE_FRAME_INTERVAL_MS = 25;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Reference to the LED matrix display object */
+  Max72xxPanel& ledMatrix;
+
+  /** Array of slide slots */
+  DigitSlide slideArray[MAX_DIGIT_SLIDES];
+
+  /** Number of active slides */
+  uint8_t activeSlides;
+
+  /** Timestamp of the last drawn frame */
+  unsigned long lastFrameTime;
+};
+
+#endif // DIGIT_SLIDE_ANIMATION_H
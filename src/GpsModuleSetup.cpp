@@ -0,0 +1,147 @@
+/**
+ * @file GpsModuleSetup.cpp
+ * @brief Implementation of the GpsModuleSetup class for GPS receiver configuration
+ *
+ * This file contains the implementation of the GpsModuleSetup class, which
+ * builds PMTK, PUBX and UBX commands and sends them to the GPS module.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "GpsModuleSetup.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** UBX message class/ID for CFG-MSG (set message rate) */
+static const uint8_t UBX_CLASS_CFG = 0x06;
+static const uint8_t UBX_ID_CFG_MSG = 0x01;
+
+/** UBX message class for standard NMEA sentences */
+static const uint8_t UBX_CLASS_NMEA = 0xF0;
+
+/** NMEA sentence IDs disabled on u-blox receivers: GLL, GSA, GSV, VTG */
+static const uint8_t UBX_UNUSED_NMEA_IDS[] = { 0x01, 0x02, 0x03, 0x05 };
+
+/** Size of the buffer used to format NMEA-style commands */
+static const uint8_t NMEA_COMMAND_BUFFER_SIZE = 40;
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for GpsModuleSetup
+ * @param port Serial port connected to the GPS module
+ */
+GpsModuleSetup::GpsModuleSetup(Stream& port) : gpsPort(port) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Enable only RMC and GGA on an MTK receiver (PMTK314)
+ *
+ * PMTK314 field order: GLL, RMC, VTG, GGA, GSA, GSV, then reserved and
+ * vendor sentences. A value of 1 means once per position fix.
+ */
+void GpsModuleSetup::configureMtkSentences() {
+  sendNmeaCommand("PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0");
+}
+
+/**
+ * @brief Change the baud rate of an MTK receiver (PMTK251)
+ * @param baudRate New baud rate (4800-115200)
+ */
+void GpsModuleSetup::setMtkBaudRate(uint32_t baudRate) {
+  char command[NMEA_COMMAND_BUFFER_SIZE];
+  snprintf(command, sizeof(command), "PMTK251,%lu", (unsigned long)baudRate);
+  sendNmeaCommand(command);
+}
+
+/**
+ * @brief Disable GLL, GSA, GSV and VTG on a u-blox receiver (UBX-CFG-MSG)
+ *
+ * Uses the short CFG-MSG form (class, ID, rate), which sets the rate on the
+ * port the command was received on.
+ */
+void GpsModuleSetup::configureUbloxSentences() {
+  for (uint8_t i = 0; i < sizeof(UBX_UNUSED_NMEA_IDS); i++) {
+    uint8_t payload[3] = { UBX_CLASS_NMEA, UBX_UNUSED_NMEA_IDS[i], 0 };
+    sendUbxMessage(UBX_CLASS_CFG, UBX_ID_CFG_MSG, payload, sizeof(payload));
+  }
+}
+
+/**
+ * @brief Change the baud rate of a u-blox receiver UART1 (PUBX,41)
+ * @param baudRate New baud rate (4800-115200)
+ *
+ * Keeps UBX+NMEA+RTCM input and UBX+NMEA output enabled on the port.
+ */
+void GpsModuleSetup::setUbloxBaudRate(uint32_t baudRate) {
+  char command[NMEA_COMMAND_BUFFER_SIZE];
+  snprintf(command, sizeof(command), "PUBX,41,1,0007,0003,%lu,0", (unsigned long)baudRate);
+  sendNmeaCommand(command);
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Send an NMEA-style command with "$", checksum and CR/LF added
+ * @param body Command text between '$' and '*' (e.g. "PMTK251,38400")
+ *
+ * The checksum is the XOR of all characters between '$' and '*'.
+ */
+void GpsModuleSetup::sendNmeaCommand(const char* body) {
+  uint8_t checksum = 0;
+  for (const char* p = body; *p != '\0'; p++) {
+    checksum ^= (uint8_t)*p;
+  }
+
+  char trailer[6];
+  snprintf(trailer, sizeof(trailer), "*%02X\r\n", checksum);
+
+  gpsPort.write('$');
+  gpsPort.print(body);
+  gpsPort.print(trailer);
+}
+
+/**
+ * @brief Send a UBX binary message with sync bytes and checksum added
+ * @param messageClass UBX message class
+ * @param messageId UBX message ID
+ * @param payload Message payload
+ * @param length Payload length in bytes
+ *
+ * The checksum is the 8-bit Fletcher checksum over class, ID, length and
+ * payload, as defined by the u-blox protocol specification.
+ */
+void GpsModuleSetup::sendUbxMessage(uint8_t messageClass, uint8_t messageId, const uint8_t* payload, uint8_t length) {
+  uint8_t header[4] = { messageClass, messageId, length, 0 };
+  uint8_t checksumA = 0;
+  uint8_t checksumB = 0;
+
+  for (uint8_t i = 0; i < sizeof(header); i++) {
+    checksumA += header[i];
+    checksumB += checksumA;
+  }
+  for (uint8_t i = 0; i < length; i++) {
+    checksumA += payload[i];
+    checksumB += checksumA;
+  }
+
+  gpsPort.write(0xB5);
+  gpsPort.write(0x62);
+  gpsPort.write(header, sizeof(header));
+  gpsPort.write(payload, length);
+  gpsPort.write(checksumA);
+  gpsPort.write(checksumB);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file GpsModuleSetup.h
+ * @brief Startup configuration commands for the GPS receiver module
+ *
+ * This file contains the GpsModuleSetup class that sends configuration
+ * commands to MTK (PMTK) and u-blox (UBX/PUBX) GPS receivers, so the module
+ * only outputs the NMEA sentences the clock actually parses.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef GPS_MODULE_SETUP_H
+#define GPS_MODULE_SETUP_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// GPS MODULE SETUP CLASS
+// ============================================================================
+
+/**
+ * @class GpsModuleSetup
+ * @brief Sends sentence-rate and baud-rate commands to the GPS receiver
+ *
+ * Both receiver families are told to output only RMC and GGA once per fix.
+ * Checksums are computed at runtime, so command bodies are plain strings.
+ *
+ * @note Requires the GPS RX pin to be connected to the Arduino TX pin
+ * @note Commands are fire-and-forget; acknowledgements are not checked
+ */
+class GpsModuleSetup {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for GpsModuleSetup
+   * @param port Serial port connected to the GPS module
+   */
+  GpsModuleSetup(Stream& port);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Enable only RMC and GGA on an MTK receiver (PMTK314)
+   */
+  void configureMtkSentences();
+
+  /**
+   * @brief Change the baud rate of an MTK receiver (PMTK251)
+   * @param baudRate New baud rate (4800-115200)
+   */
+  void setMtkBaudRate(uint32_t baudRate);
+
+  /**
+   * @brief Disable GLL, GSA, GSV and VTG on a u-blox receiver (UBX-CFG-MSG)
+   *
+   * RMC and GGA are enabled by default on u-blox receivers and left alone.
+   */
+  void configureUbloxSentences();
+
+  /**
+   * @brief Change the baud rate of a u-blox receiver UART1 (PUBX,41)
+   * @param baudRate New baud rate (4800-115200)
+   */
+  void setUbloxBaudRate(uint32_t baudRate);
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Serial port connected to the GPS module */
+  Stream& gpsPort;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Send an NMEA-style command with "$", checksum and CR/LF added
+   * @param body Command text between '$' and '*' (e.g. "PMTK251,38400")
+   */
+  void sendNmeaCommand(const char* body);
+
+  /**
+   * @brief Send a UBX binary message with sync bytes and checksum added
+   * @param messageClass UBX message class
+   * @param messageId UBX message ID
+   * @param payload Message payload
+   * @param length Payload length in bytes
+   */
+  void sendUbxMessage(uint8_t messageClass, uint8_t messageId, const uint8_t* payload, uint8_t length);
+};
+
+#endif // GPS_MODULE_SETUP_H
@@ -0,0 +1,243 @@
+/**
+ * @file GpsReceiver.cpp
+ * @brief Implementation of the GpsReceiver class for backend-independent GPS access
+ *
+ * This file contains the implementation of the GpsReceiver class, including
+ * the NMEA sentence filter and the TinyGPS++ and NeoGPS backends.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "GpsReceiver.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** Filter state: current sentence is accepted, characters go to the parser */
+static const uint8_t FILTER_PASSING = 0xFE;
+
+/** Filter state: current sentence is rejected, characters are dropped */
+static const uint8_t FILTER_SKIPPING = 0xFF;
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for GpsReceiver
+ *
+ * Starts with the sentence filter skipping until the first '$'.
+ */
+GpsReceiver::GpsReceiver()
+#if GPS_PARSER == GPS_PARSER_NEOGPS
+  : locationFixTime(0), timeUpdated(false), locationUpdated(false),
+    headerLength(FILTER_SKIPPING) {
+  mergedFix.init();
+#else
+  : timeUpdated(false), locationUpdated(false), headerLength(FILTER_SKIPPING) {
+#endif
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Feed one received character to the sentence filter and parser
+ * @param receivedChar Character received from the GPS module
+ * @return True when a complete sentence was parsed, false otherwise
+ *
+ * The "$ttSSS" header of each sentence is held back until the sentence type
+ * is known. Accepted sentences are then replayed to the parser in full;
+ * rejected ones are dropped up to the next '$'.
+ */
+bool GpsReceiver::encode(char receivedChar) {
+  if (receivedChar == '$') {
+    sentenceHeader[0] = receivedChar;
+    headerLength = 1;
+    return false;
+  }
+
+  if (headerLength == FILTER_SKIPPING) return false;
+  if (headerLength == FILTER_PASSING) return parse(receivedChar);
+
+  // Still collecting the sentence header
+  sentenceHeader[headerLength++] = receivedChar;
+  if (headerLength < sizeof(sentenceHeader)) return false;
+
+  if (!isAcceptedSentence(&sentenceHeader[3])) {
+    headerLength = FILTER_SKIPPING;
+    return false;
+  }
+
+  headerLength = FILTER_PASSING;
+  for (uint8_t i = 0; i < sizeof(sentenceHeader) - 1; i++) {
+    parse(sentenceHeader[i]);
+  }
+  return parse(sentenceHeader[sizeof(sentenceHeader) - 1]);
+}
+
+/**
+ * @brief Check for a newly parsed valid time
+ * @return True once per time-bearing sentence (clears the flag)
+ *
+ * The flags are latched in parse(), so reading values through the getters
+ * never consumes an update.
+ */
+bool GpsReceiver::isTimeUpdated() {
+  bool updated = timeUpdated;
+  timeUpdated = false;
+  return updated;
+}
+
+/**
+ * @brief Check for a newly parsed valid location
+ * @return True once per location-bearing sentence (clears the flag)
+ */
+bool GpsReceiver::isLocationUpdated() {
+  bool updated = locationUpdated;
+  locationUpdated = false;
+  return updated;
+}
+
+#if GPS_PARSER == GPS_PARSER_NEOGPS
+
+// ----------------------------------------------------------------------------
+// NeoGPS backend
+// ----------------------------------------------------------------------------
+
+bool GpsReceiver::isLocationValid() const { return mergedFix.valid.location; }
+uint32_t GpsReceiver::locationAge() const { return millis() - locationFixTime; }
+bool GpsReceiver::isAltitudeValid() const { return mergedFix.valid.altitude; }
+bool GpsReceiver::isDateValid() const { return mergedFix.valid.date; }
+bool GpsReceiver::isTimeValid() const { return mergedFix.valid.time; }
+bool GpsReceiver::isSpeedValid() const { return mergedFix.valid.speed; }
+
+int32_t GpsReceiver::latitudeE7() { return mergedFix.latitudeL(); }
+int32_t GpsReceiver::longitudeE7() { return mergedFix.longitudeL(); }
+int32_t GpsReceiver::altitudeCm() { return mergedFix.altitude_cm(); }
+uint32_t GpsReceiver::speedCentiKnots() { return mergedFix.speed_mkn() / 10; }
+
+uint16_t GpsReceiver::year() { return mergedFix.dateTime.full_year(); }
+uint8_t GpsReceiver::month() { return mergedFix.dateTime.month; }
+uint8_t GpsReceiver::day() { return mergedFix.dateTime.date; }
+uint8_t GpsReceiver::hour() { return mergedFix.dateTime.hours; }
+uint8_t GpsReceiver::minute() { return mergedFix.dateTime.minutes; }
+uint8_t GpsReceiver::second() { return mergedFix.dateTime.seconds; }
+
+// Requires NMEAGPS_STATS in the NeoGPS configuration (enabled by default)
+uint32_t GpsReceiver::passedChecksums() { return parser.statistics.ok; }
+uint32_t GpsReceiver::failedChecksums() { return parser.statistics.errors; }
+
+/**
+ * @brief Pass one character to NeoGPS and merge completed sentences
+ * @param receivedChar Character to parse
+ * @return True when a complete sentence was parsed
+ *
+ * NeoGPS only holds the fields of the sentence being parsed, so each
+ * completed sentence is merged into mergedFix to keep the last valid time,
+ * date, location and altitude together.
+ */
+bool GpsReceiver::parse(char receivedChar) {
+  if (parser.decode(receivedChar) != NMEAGPS::DECODE_COMPLETED) return false;
+
+  const gps_fix& sentenceFix = parser.fix();
+  if (sentenceFix.valid.location) {
+    locationFixTime = millis();
+    locationUpdated = true;
+  }
+  if (sentenceFix.valid.time) {
+    timeUpdated = true;
+  }
+  mergedFix |= sentenceFix;
+  return true;
+}
+
+#else
+
+// ----------------------------------------------------------------------------
+// TinyGPS++ backend
+// ----------------------------------------------------------------------------
+
+bool GpsReceiver::isLocationValid() const { return parser.location.isValid(); }
+uint32_t GpsReceiver::locationAge() const { return parser.location.age(); }
+bool GpsReceiver::isAltitudeValid() const { return parser.altitude.isValid(); }
+bool GpsReceiver::isDateValid() const { return parser.date.isValid(); }
+bool GpsReceiver::isTimeValid() const { return parser.time.isValid(); }
+bool GpsReceiver::isSpeedValid() const { return parser.speed.isValid(); }
+
+int32_t GpsReceiver::latitudeE7() { return rawDegreesToE7(parser.location.rawLat()); }
+int32_t GpsReceiver::longitudeE7() { return rawDegreesToE7(parser.location.rawLng()); }
+int32_t GpsReceiver::altitudeCm() { return parser.altitude.value(); }
+uint32_t GpsReceiver::speedCentiKnots() { return parser.speed.value(); }
+
+uint16_t GpsReceiver::year() { return parser.date.year(); }
+uint8_t GpsReceiver::month() { return parser.date.month(); }
+uint8_t GpsReceiver::day() { return parser.date.day(); }
+uint8_t GpsReceiver::hour() { return parser.time.hour(); }
+uint8_t GpsReceiver::minute() { return parser.time.minute(); }
+uint8_t GpsReceiver::second() { return parser.time.second(); }
+
+uint32_t GpsReceiver::passedChecksums() { return parser.passedChecksum(); }
+uint32_t GpsReceiver::failedChecksums() { return parser.failedChecksum(); }
+
+/**
+ * @brief Pass one character to TinyGPS++ and latch the update flags
+ * @param receivedChar Character to parse
+ * @return True when a complete, valid sentence was parsed
+ *
+ * TinyGPS++ clears its updated flags whenever a value is read, so any
+ * getter call (display, telemetry, debug output) would consume an update.
+ * They are copied to timeUpdated/locationUpdated here and then cleared, so
+ * the next sentence without that field doesn't latch them again.
+ */
+bool GpsReceiver::parse(char receivedChar) {
+  if (!parser.encode(receivedChar)) return false;
+
+  if (parser.time.isUpdated()) {
+    parser.time.value();  // Reading the value clears the TinyGPS++ updated flag
+    if (parser.time.isValid()) timeUpdated = true;
+  }
+  if (parser.location.isUpdated()) {
+    parser.location.rawLat();  // Reading the value clears the TinyGPS++ updated flag
+    if (parser.location.isValid()) locationUpdated = true;
+  }
+  return true;
+}
+
+/**
+ * @brief Convert a TinyGPS++ raw coordinate to degrees × 10^7
+ * @param raw Whole degrees, billionths and sign as parsed by TinyGPS++
+ * @return Coordinate in degrees × 10^7 (rounded, same scale as NeoGPS)
+ */
+int32_t GpsReceiver::rawDegreesToE7(const RawDegrees& raw) {
+  int32_t value = (int32_t)raw.deg * 10000000L + (int32_t)((raw.billionths + 50) / 100);
+  return raw.negative ? -value : value;
+}
+
+#endif
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Check if a sentence type is accepted by the filter
+ * @param type Three-letter sentence type (e.g. "RMC"), not null-terminated
+ * @return True if sentences of this type should be parsed
+ */
+bool GpsReceiver::isAcceptedSentence(const char* type) {
+  #if GPS_ACCEPTED_SENTENCES & GPS_SENTENCE_RMC
+  if (type[0] == 'R' && type[1] == 'M' && type[2] == 'C') return true;
+  #endif
+
+  #if GPS_ACCEPTED_SENTENCES & GPS_SENTENCE_GGA
+  if (type[0] == 'G' && type[1] == 'G' && type[2] == 'A') return true;
+  #endif
+
+  return false;
+}
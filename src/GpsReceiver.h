@@ -0,0 +1,218 @@
+/**
+ * @file GpsReceiver.h
+ * @brief GPS parser abstraction with build-time backend selection
+ *
+ * This file contains the GpsReceiver class that hides the NMEA parser library
+ * behind a small interface used by the clock code. The parser backend
+ * (TinyGPS++ or NeoGPS) is chosen at build time, and a sentence filter in
+ * front of the parser discards NMEA sentences the clock never uses.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef GPS_RECEIVER_H
+#define GPS_RECEIVER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// BACKEND SELECTION
+// ============================================================================
+
+/** TinyGPS++ backend (default) */
+#define GPS_PARSER_TINYGPSPLUS          1
+
+/** NeoGPS backend, smaller and faster on AVR */
+#define GPS_PARSER_NEOGPS               2
+
+/**
+ * Parser backend, selected with -D GPS_PARSER=... in platformio.ini build_flags
+ * so every translation unit sees the same choice (see env:nanoatmega328_neogps)
+ */
+#ifndef GPS_PARSER
+#define GPS_PARSER                      GPS_PARSER_TINYGPSPLUS
+#endif
+
+#if GPS_PARSER == GPS_PARSER_NEOGPS
+#include <NMEAGPS.h>
+#else
+#include <TinyGPS++.h>
+#endif
+
+// ============================================================================
+// SENTENCE FILTER
+// ============================================================================
+
+/** Pass RMC sentences (time, date, position, speed) to the parser */
+#define GPS_SENTENCE_RMC                0x01
+
+/** Pass GGA sentences (time, position, altitude) to the parser */
+#define GPS_SENTENCE_GGA                0x02
+
+/** Sentences passed to the parser; all others are dropped before parsing */
+#ifndef GPS_ACCEPTED_SENTENCES
+#define GPS_ACCEPTED_SENTENCES          (GPS_SENTENCE_RMC | GPS_SENTENCE_GGA)
+#endif
+
+// ============================================================================
+// GPS RECEIVER CLASS
+// ============================================================================
+
+/**
+ * @class GpsReceiver
+ * @brief Backend-independent access to the GPS time, date and position
+ *
+ * Features:
+ * - Same interface for TinyGPS++ and NeoGPS
+ * - Sentence filter: only RMC/GGA reach the parser, so GSV/GSA/VTG/GLL are
+ *   never tokenized or checksummed
+ * - Location age and update tracking for both backends
+ * - Fixed-point position accessors, so no float math is needed on AVR
+ *
+ * @note Accessors return the last valid values, like TinyGPS++ does
+ */
+class GpsReceiver {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for GpsReceiver
+   */
+  GpsReceiver();
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Feed one received character to the sentence filter and parser
+   * @param receivedChar Character received from the GPS module
+   * @return True when a complete sentence was parsed, false otherwise
+   */
+  bool encode(char receivedChar);
+
+  /** @return True if a valid location has been received */
+  bool isLocationValid() const;
+
+  /** @return Milliseconds since the last valid location was received */
+  uint32_t locationAge() const;
+
+  /** @return True if a valid altitude has been received */
+  bool isAltitudeValid() const;
+
+  /** @return True if a valid date has been received */
+  bool isDateValid() const;
+
+  /** @return True if a valid time has been received */
+  bool isTimeValid() const;
+
+  /** @return True if a valid ground speed has been received */
+  bool isSpeedValid() const;
+
+  /** @return True once per newly parsed valid time (clears the flag) */
+  bool isTimeUpdated();
+
+  /** @return True once per newly parsed valid location (clears the flag) */
+  bool isLocationUpdated();
+
+  /** @return Latitude in degrees × 10^7 (negative for south) */
+  int32_t latitudeE7();
+
+  /** @return Longitude in degrees × 10^7 (negative for west) */
+  int32_t longitudeE7();
+
+  /** @return Altitude in centimeters */
+  int32_t altitudeCm();
+
+  /** @return Ground speed in knots × 100 */
+  uint32_t speedCentiKnots();
+
+  /** @return Full year, e.g. 2025 (UTC) */
+  uint16_t year();
+
+  /** @return Month 1-12 (UTC) */
+  uint8_t month();
+
+  /** @return Day of month 1-31 (UTC) */
+  uint8_t day();
+
+  /** @return Hour 0-23 (UTC) */
+  uint8_t hour();
+
+  /** @return Minute 0-59 (UTC) */
+  uint8_t minute();
+
+  /** @return Second 0-59 (UTC) */
+  uint8_t second();
+
+  /** @return Sentences parsed with a valid checksum */
+  uint32_t passedChecksums();
+
+  /** @return Sentences rejected because of a checksum or format error */
+  uint32_t failedChecksums();
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+#if GPS_PARSER == GPS_PARSER_NEOGPS
+  /** NeoGPS parser */
+  NMEAGPS parser;
+
+  /** Fields of all parsed sentences merged together */
+  gps_fix mergedFix;
+
+  /** Timestamp of the last valid location */
+  unsigned long locationFixTime;
+#else
+  /** TinyGPS++ parser */
+  TinyGPSPlus parser;
+#endif
+
+  /** Set when a sentence with a valid time was parsed */
+  bool timeUpdated;
+
+  /** Set when a sentence with a valid location was parsed */
+  bool locationUpdated;
+
+  /** Header characters held back until the sentence type is known ("$GPRMC") */
+  char sentenceHeader[6];
+
+  /** Number of header characters collected, or a filter state below */
+  uint8_t headerLength;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Check if a sentence type is accepted by the filter
+   * @param type Three-letter sentence type (e.g. "RMC"), not null-terminated
+   * @return True if sentences of this type should be parsed
+   */
+  static bool isAcceptedSentence(const char* type);
+
+  /**
+   * @brief Pass one character to the parser backend
+   * @param receivedChar Character to parse
+   * @return True when a complete sentence was parsed
+   */
+  bool parse(char receivedChar);
+
+#if GPS_PARSER != GPS_PARSER_NEOGPS
+  /**
+   * @brief Convert a TinyGPS++ raw coordinate to degrees × 10^7
+   * @param raw Whole degrees, billionths and sign as parsed by TinyGPS++
+   * @return Coordinate in degrees × 10^7
+   */
+  static int32_t rawDegreesToE7(const RawDegrees& raw);
+#endif
+};
+
+#endif // GPS_RECEIVER_H
@@ -0,0 +1,121 @@
+/**
+ * @file GpsRxBuffer.cpp
+ * @brief Implementation of the GpsRxBuffer class for GPS serial buffering
+ *
+ * This file contains the implementation of the GpsRxBuffer class, a single
+ * producer / single consumer ring buffer filled from interrupt context.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "GpsRxBuffer.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for GpsRxBuffer
+ * @param source Serial port the GPS module is connected to
+ * @param storage Buffer memory used for the ring buffer
+ * @param size Size of the storage in bytes (2-256)
+ *
+ * Initializes an empty ring buffer with all counters cleared.
+ */
+GpsRxBuffer::GpsRxBuffer(Stream& source, uint8_t* storage, uint16_t size)
+  : source(source), buffer(storage), lastIndex(size - 1), head(0), tail(0) {
+  counters.bytesReceived = 0;
+  counters.bytesDropped = 0;
+  counters.hardwareOverflows = 0;
+  counters.highWaterMark = 0;
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Move all pending bytes from the serial port into the ring buffer
+ *
+ * A full hardware serial buffer at capture time means the USART interrupt
+ * may already have discarded bytes, so it is counted separately from drops
+ * caused by this ring buffer being full.
+ */
+void GpsRxBuffer::capture() {
+  int pending = source.available();
+  if (pending == 0) return;
+
+  #ifdef SERIAL_RX_BUFFER_SIZE
+  if (pending >= SERIAL_RX_BUFFER_SIZE - 1) {
+    counters.hardwareOverflows++;
+  }
+  #endif
+
+  uint8_t writeIndex = head;
+  while (pending-- > 0) {
+    uint8_t receivedByte = source.read();
+    uint8_t next = nextIndex(writeIndex);
+
+    if (next == tail) {
+      // Ring buffer full - oldest data is kept, new byte is lost
+      counters.bytesDropped++;
+      continue;
+    }
+
+    buffer[writeIndex] = receivedByte;
+    writeIndex = next;
+    counters.bytesReceived++;
+  }
+  head = writeIndex;
+
+  uint8_t fillLevel = available();
+  if (fillLevel > counters.highWaterMark) {
+    counters.highWaterMark = fillLevel;
+  }
+}
+
+/**
+ * @brief Get the number of bytes waiting in the ring buffer
+ * @return Number of bytes available to read
+ */
+uint8_t GpsRxBuffer::available() const {
+  uint8_t writeIndex = head;
+  uint8_t readIndex = tail;
+
+  if (writeIndex >= readIndex) {
+    return writeIndex - readIndex;
+  }
+  return (uint16_t)lastIndex + 1 - readIndex + writeIndex;
+}
+
+/**
+ * @brief Read the oldest byte from the ring buffer
+ * @return The byte read, or -1 if the buffer is empty
+ */
+int GpsRxBuffer::read() {
+  uint8_t readIndex = tail;
+  if (readIndex == head) return -1;
+
+  uint8_t receivedByte = buffer[readIndex];
+  tail = nextIndex(readIndex);
+  return receivedByte;
+}
+
+/**
+ * @brief Take a consistent snapshot of the buffer counters
+ * @param stats Structure to copy the counters into
+ *
+ * Interrupts are briefly disabled because the 32-bit counters cannot be
+ * read atomically on AVR.
+ */
+void GpsRxBuffer::getStats(GpsRxStats& stats) const {
+  noInterrupts();
+  stats.bytesReceived = counters.bytesReceived;
+  stats.bytesDropped = counters.bytesDropped;
+  stats.hardwareOverflows = counters.hardwareOverflows;
+  stats.highWaterMark = counters.highWaterMark;
+  interrupts();
+}
@@ -0,0 +1,138 @@
+/**
+ * @file GpsRxBuffer.h
+ * @brief Interrupt-filled receive buffer for GPS serial data
+ *
+ * This file contains the GpsRxBuffer class that moves GPS bytes out of the
+ * small hardware serial buffer into a larger ring buffer from interrupt
+ * context, and keeps counters that show whether any bytes were lost.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef GPS_RX_BUFFER_H
+#define GPS_RX_BUFFER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * @struct GpsRxStats
+ * @brief Snapshot of the GPS receive buffer counters
+ */
+struct GpsRxStats {
+  uint32_t bytesReceived;     /**< Bytes moved into the ring buffer */
+  uint32_t bytesDropped;      /**< Bytes lost because the ring buffer was full */
+  uint16_t hardwareOverflows; /**< Captures that found the hardware serial buffer full */
+  uint8_t highWaterMark;      /**< Highest ring buffer fill level seen */
+};
+
+// ============================================================================
+// GPS RX BUFFER CLASS
+// ============================================================================
+
+/**
+ * @class GpsRxBuffer
+ * @brief Ring buffer between the GPS serial port and the NMEA parser
+ *
+ * The Arduino core already receives bytes into a 64-byte buffer from the
+ * USART RX interrupt and owns that interrupt vector. capture() is meant to be
+ * called from a periodic timer interrupt: it empties the core buffer into a
+ * larger ring buffer long before the core buffer can overflow, even while the
+ * main loop is busy. The main loop then reads bytes back with available() and
+ * read() at its own pace.
+ *
+ * Features:
+ * - Caller-provided storage, so the size is set in config.h
+ * - Single producer (interrupt) / single consumer (main loop), lock-free
+ * - Received, dropped and high-water counters for overrun diagnostics
+ *
+ * @note Storage size must be between 2 and 256 bytes (8-bit indices keep
+ *       the interrupt/main loop hand-over atomic on AVR)
+ */
+class GpsRxBuffer {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for GpsRxBuffer
+   * @param source Serial port the GPS module is connected to
+   * @param storage Buffer memory used for the ring buffer
+   * @param size Size of the storage in bytes (2-256)
+   */
+  GpsRxBuffer(Stream& source, uint8_t* storage, uint16_t size);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Move all pending bytes from the serial port into the ring buffer
+   *
+   * Bytes that do not fit are discarded and counted as dropped.
+   *
+   * @note Intended to run from a timer interrupt; keep other callers out
+   */
+  void capture();
+
+  /**
+   * @brief Get the number of bytes waiting in the ring buffer
+   * @return Number of bytes available to read
+   */
+  uint8_t available() const;
+
+  /**
+   * @brief Read the oldest byte from the ring buffer
+   * @return The byte read, or -1 if the buffer is empty
+   */
+  int read();
+
+  /**
+   * @brief Take a consistent snapshot of the buffer counters
+   * @param stats Structure to copy the counters into
+   */
+  void getStats(GpsRxStats& stats) const;
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Serial port the GPS bytes are read from */
+  Stream& source;
+
+  /** Ring buffer storage */
+  uint8_t* buffer;
+
+  /** Ring buffer size in bytes (stored as size - 1 to fit 256 in a byte) */
+  uint8_t lastIndex;
+
+  /** Write index, only changed by capture() */
+  volatile uint8_t head;
+
+  /** Read index, only changed by read() */
+  volatile uint8_t tail;
+
+  /** Counters, only changed by capture() */
+  volatile GpsRxStats counters;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Advance a ring buffer index by one position
+   * @param index Index to advance
+   * @return Next index, wrapped to the buffer size
+   */
+  uint8_t nextIndex(uint8_t index) const { return index == lastIndex ? 0 : index + 1; }
+};
+
+#endif // GPS_RX_BUFFER_H
@@ -20,13 +20,15 @@
 
 /**
  * @brief Constructor for GpsStabilityFilter
- * @param gps Reference to the TinyGPSPlus GPS module object
+ * @param gps Reference to the GPS receiver object
  * 
  * Initializes the GPS stability filter by setting up the member variables
  * and resetting all buffer indices and counters.
  */
-GpsStabilityFilter::GpsStabilityFilter(TinyGPSPlus& gps) 
-  : gpsModule(gps), currentIndex(0), totalReadings(0) {
+GpsStabilityFilter::GpsStabilityFilter(GpsReceiver& gps) 
+  : gpsModule(gps), filteredLat(0), filteredLon(0), filteredAlt(0),
+    lastUpdateTime(0), strategy(GPS_FILTER_AUTO), moving(false),
+    filteredReady(false), currentIndex(0), totalReadings(0) {
   // Arrays are automatically initialized to zero by default
   // No need to explicitly initialize the reading arrays
 }
@@ -38,178 +40,270 @@ GpsStabilityFilter::GpsStabilityFilter(TinyGPSPlus& gps)
 /**
  * @brief Update GPS stability filter with new coordinate readings
  * 
- * This method adds new GPS readings to the stability filter buffers using
- * a FIFO (First In, First Out) approach. It should be called whenever new
- * valid GPS location data is available.
+ * This method feeds the new GPS readings to the alpha-beta tracks and, when
+ * stationary, to the trimmed-mean windows. The filtered values are cached,
+ * so the getters only read results.
  * 
  * @note Automatically manages buffer overflow using circular buffer approach
  * @note Only updates filter if GPS location and altitude data are valid
  */
 void GpsStabilityFilter::update() {
   // Only update filter if GPS location data is valid
-  if (!gpsModule.location.isValid() || !gpsModule.altitude.isValid()) {
+  if (!gpsModule.isLocationValid() || !gpsModule.isAltitudeValid()) {
     return;
   }
 
-  // Add new readings to the FIFO buffers
-  latReadings[currentIndex] = gpsModule.location.lat();
-  lonReadings[currentIndex] = gpsModule.location.lng();
-  altReadings[currentIndex] = gpsModule.altitude.feet();
+  int32_t lat = gpsModule.latitudeE7();
+  int32_t lon = gpsModule.longitudeE7();
+  int32_t alt = gpsModule.altitudeCm();
 
-  // Update indices and counters (circular buffer)
-  currentIndex = (currentIndex + 1) % GPS_FILTER_WINDOW_SIZE;
-  
-  // Track total readings for adaptive window sizing
-  if (totalReadings < GPS_FILTER_WINDOW_SIZE) {
-    totalReadings++;
+  // Alpha-beta tracks run continuously (except in pure trimmed-mean mode)
+  // so they are already settled when motion starts
+  if (strategy != GPS_FILTER_TRIMMED_MEAN) {
+    unsigned long currentTime = millis();
+    unsigned long elapsed = currentTime - lastUpdateTime;
+
+    if (!filteredReady || elapsed > GPS_FILTER_TRACK_MAX_GAP_MS) {
+      latTrack.position = lat;
+      lonTrack.position = lon;
+      altTrack.position = alt;
+      latTrack.velocity = lonTrack.velocity = altTrack.velocity = 0;
+      lastUpdateTime = currentTime;
+    } else if (elapsed >= GPS_FILTER_TRACK_MIN_INTERVAL_MS) {
+      // Repeated readings of the same fix are skipped, they carry no velocity
+      updateTrack(latTrack, lat, elapsed);
+      updateTrack(lonTrack, lon, elapsed);
+      updateTrack(altTrack, alt, elapsed);
+      lastUpdateTime = currentTime;
+    }
   }
+
+  moving = detectMotion();
+  if (moving) {
+    // Restart the window so stationary readings from the old position are dropped
+    currentIndex = 0;
+    totalReadings = 0;
+
+    filteredLat = latTrack.position;
+    filteredLon = lonTrack.position;
+    filteredAlt = altTrack.position;
+  } else {
+    updateWindows(lat, lon, alt);
+  }
+  filteredReady = true;
+}
+
+/**
+ * @brief Select the filter strategy
+ * @param newStrategy Trimmed mean, alpha-beta, or automatic selection by speed
+ * 
+ * The tracks restart with the next reading, since they may not have been
+ * updated under the previous strategy.
+ */
+void GpsStabilityFilter::setStrategy(GpsFilterStrategy newStrategy) {
+  strategy = newStrategy;
+  filteredReady = false;
+  currentIndex = 0;
+  totalReadings = 0;
 }
 
 /**
  * @brief Get filtered latitude value using hybrid median+average filter
  * 
- * This method applies a hybrid filtering approach:
- * 1. Creates a working copy of recent latitude readings
- * 2. Sorts the values to find the median (removes outliers)
- * 3. Calculates average of the middle values for final result
+ * Returns the latitude cached by update(): the trimmed mean of the window
+ * when stationary, the alpha-beta estimate when moving.
  * 
- * @return Filtered latitude value, or raw GPS value if insufficient data
+ * @return Filtered latitude in degrees × 10^7, or raw GPS value if insufficient data
  */
-float GpsStabilityFilter::getFilteredLatitude() {
-  // If insufficient readings available, return raw GPS value
-  if (totalReadings < GPS_FILTER_MIN_READINGS || !gpsModule.location.isValid()) {
-    return gpsModule.location.lat();
+int32_t GpsStabilityFilter::getFilteredLatitudeE7() {
+  // If no filtered value is available yet, return raw GPS value
+  if (!filteredReady || !gpsModule.isLocationValid()) {
+    return gpsModule.latitudeE7();
   }
 
-  // Create working copy of readings for sorting (preserve original buffer)  
-  float workingBuffer[GPS_FILTER_WINDOW_SIZE];
-  uint8_t readingsToProcess = totalReadings;
-  
-  for (uint8_t i = 0; i < readingsToProcess; i++) {
-    workingBuffer[i] = latReadings[i];
-  }
-
-  // Sort values to find median and remove outliers
-  sortFloatArray(workingBuffer, readingsToProcess);
+  return filteredLat;
+}
 
-  // Calculate average of middle values (hybrid median+average approach)
-  // Use middle 60% of values to balance stability and responsiveness
-  uint8_t startIndex = readingsToProcess > 5 ? readingsToProcess / 5 : 0;  // Skip bottom 20% if enough readings
-  uint8_t endIndex = readingsToProcess > 5 ? readingsToProcess - startIndex : readingsToProcess;  // Skip top 20% if enough readings
-  
-  float sum = 0.0;
-  uint8_t count = 0;
-  
-  for (uint8_t i = startIndex; i < endIndex; i++) {
-    sum += workingBuffer[i];
-    count++;
+/**
+ * @brief Get filtered longitude value using hybrid median+average filter
+ * 
+ * Returns the longitude cached by update(): the trimmed mean of the window
+ * when stationary, the alpha-beta estimate when moving.
+ * 
+ * @return Filtered longitude in degrees × 10^7, or raw GPS value if insufficient data
+ */
+int32_t GpsStabilityFilter::getFilteredLongitudeE7() {
+  // If no filtered value is available yet, return raw GPS value
+  if (!filteredReady || !gpsModule.isLocationValid()) {
+    return gpsModule.longitudeE7();
   }
 
-  return (count > 0) ? (sum / count) : gpsModule.location.lat();
+  return filteredLon;
 }
 
 /**
- * @brief Get filtered longitude value using hybrid median+average filter
+ * @brief Get filtered altitude value using hybrid median+average filter
  * 
- * This method applies the same hybrid filtering approach as getFilteredLatitude()
- * but operates on longitude readings from the GPS filter buffer.
+ * Returns the altitude cached by update(): the trimmed mean of the window
+ * when stationary, the alpha-beta estimate when moving.
  * 
- * @return Filtered longitude value, or raw GPS value if insufficient data
+ * @return Filtered altitude in centimeters, or raw GPS value if insufficient data
  */
-float GpsStabilityFilter::getFilteredLongitude() {
-  // If insufficient readings available, return raw GPS value
-  if (totalReadings < GPS_FILTER_MIN_READINGS || !gpsModule.location.isValid()) {
-    return gpsModule.location.lng();
+int32_t GpsStabilityFilter::getFilteredAltitudeCm() {
+  // If no filtered value is available yet, return raw GPS value
+  if (!filteredReady || !gpsModule.isAltitudeValid()) {
+    return gpsModule.altitudeCm();
   }
 
-  // Create working copy of readings for sorting (preserve original buffer)
-  float workingBuffer[GPS_FILTER_WINDOW_SIZE];
-  uint8_t readingsToProcess = totalReadings;
-  
-  for (uint8_t i = 0; i < readingsToProcess; i++) {
-    workingBuffer[i] = lonReadings[i];
-  }
+  return filteredAlt;
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
 
-  // Sort values to find median and remove outliers
-  sortFloatArray(workingBuffer, readingsToProcess);
+/**
+ * @brief Decide between motion and stationary mode from the ground speed
+ * @return True if the alpha-beta filter should provide the values
+ * 
+ * Separate start and stop thresholds keep the mode from flapping around a
+ * single speed, e.g. in slow traffic.
+ */
+bool GpsStabilityFilter::detectMotion() {
+  if (strategy == GPS_FILTER_TRIMMED_MEAN) return false;
+  if (strategy == GPS_FILTER_ALPHA_BETA) return true;
+  if (!gpsModule.isSpeedValid()) return false;
 
-  // Calculate average of middle values (hybrid median+average approach)
-  uint8_t startIndex = readingsToProcess > 5 ? readingsToProcess / 5 : 0;  // Skip bottom 20% if enough readings
-  uint8_t endIndex = readingsToProcess > 5 ? readingsToProcess - startIndex : readingsToProcess;  // Skip top 20% if enough readings
-  
-  float sum = 0.0;
-  uint8_t count = 0;
+  uint32_t speed = gpsModule.speedCentiKnots();
+  return moving ? speed >= GPS_FILTER_MOTION_STOP_CKN : speed >= GPS_FILTER_MOTION_START_CKN;
+}
+
+/**
+ * @brief Add one reading to the trimmed-mean windows and cache the result
+ * @param lat Latitude reading (degrees × 10^7)
+ * @param lon Longitude reading (degrees × 10^7)
+ * @param alt Altitude reading (centimeters)
+ */
+void GpsStabilityFilter::updateWindows(int32_t lat, int32_t lon, int32_t alt) {
+  // Keep sorted windows in step with the circular buffers
+  // (the slot at currentIndex holds the oldest reading once the window is full)
+  replaceSorted(latSorted, totalReadings, latReadings[currentIndex], lat);
+  replaceSorted(lonSorted, totalReadings, lonReadings[currentIndex], lon);
+  replaceSorted(altSorted, totalReadings, altReadings[currentIndex], alt);
+
+  // Add new readings to the FIFO buffers
+  latReadings[currentIndex] = lat;
+  lonReadings[currentIndex] = lon;
+  altReadings[currentIndex] = alt;
+
+  // Update indices and counters (circular buffer)
+  currentIndex = (currentIndex + 1) % GPS_FILTER_WINDOW_SIZE;
   
-  for (uint8_t i = startIndex; i < endIndex; i++) {
-    sum += workingBuffer[i];
-    count++;
+  // Track total readings for adaptive window sizing
+  if (totalReadings < GPS_FILTER_WINDOW_SIZE) {
+    totalReadings++;
   }
 
-  return (count > 0) ? (sum / count) : gpsModule.location.lng();
+  // Cache filtered values (hybrid median+average approach),
+  // or the raw reading until the window holds enough readings
+  if (totalReadings < GPS_FILTER_MIN_READINGS) {
+    filteredLat = lat;
+    filteredLon = lon;
+    filteredAlt = alt;
+    return;
+  }
+
+  filteredLat = trimmedMean(latSorted, totalReadings);
+  filteredLon = trimmedMean(lonSorted, totalReadings);
+  filteredAlt = trimmedMean(altSorted, totalReadings);
 }
 
 /**
- * @brief Get filtered altitude value using hybrid median+average filter
+ * @brief Advance an alpha-beta track by one reading
+ * @param track Track to update
+ * @param measurement New reading
+ * @param elapsedMs Time since the previous reading (milliseconds)
  * 
- * This method applies the same hybrid filtering approach as other coordinate
- * filtering functions but operates on altitude readings in feet.
- * 
- * @return Filtered altitude value, or raw GPS value if insufficient data
+ * Predicts the value from the estimated velocity, then corrects position and
+ * velocity by fixed shares (alpha, beta) of the residual. All integer; a
+ * residual too large for the fixed-point gains restarts the track.
  */
-float GpsStabilityFilter::getFilteredAltitude() {
-  // If insufficient readings available, return raw GPS value
-  if (totalReadings < GPS_FILTER_MIN_READINGS || !gpsModule.altitude.isValid()) {
-    return gpsModule.altitude.feet();
-  }
+void GpsStabilityFilter::updateTrack(GpsTrack& track, int32_t measurement, unsigned long elapsedMs) {
+  int32_t predicted = track.position + (int32_t)((track.velocity * (int32_t)elapsedMs) / 1000);
+  int32_t residual = measurement - predicted;
 
-  // Create working copy of readings for sorting (preserve original buffer)
-  float workingBuffer[GPS_FILTER_WINDOW_SIZE];
-  uint8_t readingsToProcess = totalReadings;
-  
-  for (uint8_t i = 0; i < readingsToProcess; i++) {
-    workingBuffer[i] = altReadings[i];
+  if (residual > GPS_FILTER_TRACK_MAX_RESIDUAL || residual < -GPS_FILTER_TRACK_MAX_RESIDUAL) {
+    track.position = measurement;
+    track.velocity = 0;
+    return;
   }
 
-  // Sort values to find median and remove outliers
-  sortFloatArray(workingBuffer, readingsToProcess);
+  track.position = predicted + (residual * GPS_FILTER_ALPHA) / 256;
+  track.velocity += ((residual * GPS_FILTER_BETA) / 256) * 1000 / (int32_t)elapsedMs;
 
-  // Calculate average of middle values (hybrid median+average approach)
-  uint8_t startIndex = readingsToProcess > 5 ? readingsToProcess / 5 : 0;  // Skip bottom 20% if enough readings
-  uint8_t endIndex = readingsToProcess > 5 ? readingsToProcess - startIndex : readingsToProcess;  // Skip top 20% if enough readings
-  
-  float sum = 0.0;
-  uint8_t count = 0;
-  
-  for (uint8_t i = startIndex; i < endIndex; i++) {
-    sum += workingBuffer[i];
-    count++;
+  // Bound the velocity so the next prediction cannot overflow
+  track.velocity = constrain(track.velocity, -GPS_FILTER_TRACK_MAX_VELOCITY, GPS_FILTER_TRACK_MAX_VELOCITY);
+}
+
+/**
+ * @brief Replace one value in a sorted array, keeping it sorted
+ * 
+ * Removes oldValue (if the window is full) and inserts newValue at its
+ * sorted position. Each step shifts only part of the array, so a window of n
+ * readings costs O(n) per update instead of an O(n²) sort per getter call.
+ * 
+ * @param sorted Sorted array of readings
+ * @param count Number of readings in the array before the update
+ * @param oldValue Reading leaving the window (ignored if count < window size)
+ * @param newValue Reading entering the window
+ */
+void GpsStabilityFilter::replaceSorted(int32_t sorted[], uint8_t count, int32_t oldValue, int32_t newValue) {
+  // Remove the oldest reading once the window is full
+  if (count == GPS_FILTER_WINDOW_SIZE) {
+    uint8_t removeIndex = 0;
+    while (removeIndex < count - 1 && sorted[removeIndex] != oldValue) {
+      removeIndex++;
+    }
+    for (uint8_t i = removeIndex; i < count - 1; i++) {
+      sorted[i] = sorted[i + 1];
+    }
+    count--;
   }
 
-  return (count > 0) ? (sum / count) : gpsModule.altitude.feet();
+  // Insert the new reading, shifting larger values up
+  uint8_t insertIndex = count;
+  while (insertIndex > 0 && sorted[insertIndex - 1] > newValue) {
+    sorted[insertIndex] = sorted[insertIndex - 1];
+    insertIndex--;
+  }
+  sorted[insertIndex] = newValue;
 }
 
-// ============================================================================
-// PRIVATE METHODS
-// ============================================================================
-
 /**
- * @brief Helper function to sort an array of float values (for median calculation)
+ * @brief Calculate the trimmed mean of a sorted array
  * 
- * This function performs a simple bubble sort on a small array of float values.
- * Used internally by the GPS filtering functions to calculate median values.
+ * Uses the middle 60% of values to balance stability and responsiveness.
+ * The values are summed as offsets from the smallest one: readings in one
+ * window lie close together, so the sum fits in 32 bits at any coordinate.
  * 
- * @param arr Array of float values to sort
- * @param n Number of elements in the array
+ * @param sorted Sorted array of readings
+ * @param count Number of readings in the array
+ * @return Average of the middle values
  */
-void GpsStabilityFilter::sortFloatArray(float arr[], uint8_t n) {
-  for (uint8_t i = 0; i < n - 1; i++) {
-    for (uint8_t j = 0; j < n - i - 1; j++) {
-      if (arr[j] > arr[j + 1]) {
-        // Swap elements
-        float temp = arr[j];
-        arr[j] = arr[j + 1];
-        arr[j + 1] = temp;
-      }
-    }
+int32_t GpsStabilityFilter::trimmedMean(const int32_t sorted[], uint8_t count) {
+  uint8_t startIndex = count > 5 ? count / 5 : 0;  // Skip bottom 20% if enough readings
+  uint8_t endIndex = count > 5 ? count - startIndex : count;  // Skip top 20% if enough readings
+  
+  if (endIndex <= startIndex) return 0;
+
+  int32_t base = sorted[startIndex];
+  uint32_t offsetSum = 0;
+  
+  for (uint8_t i = startIndex + 1; i < endIndex; i++) {
+    offsetSum += (uint32_t)(sorted[i] - base);
   }
-}
\ No newline at end of file
+
+  // Offsets are non-negative (sorted array), round to nearest
+  uint8_t n = endIndex - startIndex;
+  return base + (int32_t)((offsetSum + n / 2) / n);
+}
@@ -16,7 +16,7 @@
 #define GPS_STABILITY_FILTER_H
 
 #include <Arduino.h>
-#include <TinyGPS++.h>
+#include "GpsReceiver.h"
 
 // ============================================================================
 // CONSTANTS
@@ -28,6 +28,59 @@
 /** Minimum readings needed before filtering (adaptive window) */
 #define GPS_FILTER_MIN_READINGS         3
 
+/** Fixed-point scale of stored coordinates (degrees × 10^7, ~1 cm resolution) */
+#define GPS_FILTER_COORD_SCALE          10000000L
+
+/** Ground speed above which the receiver is considered moving (knots × 100, ~5.6 km/h) */
+#define GPS_FILTER_MOTION_START_CKN     300
+
+/** Ground speed below which the receiver is considered stationary again (knots × 100) */
+#define GPS_FILTER_MOTION_STOP_CKN      150
+
+/** Alpha-beta position gain (/256, 0.5) */
+#define GPS_FILTER_ALPHA                128
+
+/** Alpha-beta velocity gain (/256, ~0.1) */
+#define GPS_FILTER_BETA                 26
+
+/** Readings further apart than this restart the alpha-beta tracks (milliseconds) */
+#define GPS_FILTER_TRACK_MAX_GAP_MS     5000
+
+/** Readings closer together than this do not update the tracks (milliseconds) */
+#define GPS_FILTER_TRACK_MIN_INTERVAL_MS 100
+
+/**
+ * Residuals larger than this restart a track (0.001°, ~110 m latitude; 100 m
+ * altitude). A bigger jump is a new position, not motion, and correcting
+ * towards it would leave a large velocity behind that overshoots for many
+ * readings.
+ */
+#define GPS_FILTER_TRACK_MAX_RESIDUAL   10000L
+
+/** Velocity limit of a track, keeps predictions within 32 bits (units per second) */
+#define GPS_FILTER_TRACK_MAX_VELOCITY   400000L
+
+// ============================================================================
+// DATA TYPES
+// ============================================================================
+
+/**
+ * @brief Filter strategy used by GpsStabilityFilter
+ */
+enum GpsFilterStrategy {
+  GPS_FILTER_AUTO,            ///< Alpha-beta while moving, trimmed mean when stationary
+  GPS_FILTER_TRIMMED_MEAN,    ///< Always trimmed mean (fixed installations)
+  GPS_FILTER_ALPHA_BETA       ///< Always alpha-beta (vehicle installations)
+};
+
+/**
+ * @brief Constant-velocity alpha-beta track of one coordinate
+ */
+struct GpsTrack {
+  int32_t position;           ///< Estimated value (same unit as the readings)
+  int32_t velocity;           ///< Estimated rate of change (units per second)
+};
+
 // ============================================================================
 // GPS STABILITY FILTER CLASS
 // ============================================================================
@@ -44,18 +97,29 @@
  * Features:
  * - Hybrid median + average filtering algorithm
  * - Circular buffer for efficient memory management  
+ * - Sorted window kept up to date on every reading (no sorting in getters)
  * - Adaptive window sizing for quick startup
  * - Support for negative coordinates (Southern/Western hemispheres)
- * - Memory efficient (146 bytes total)
+ * - Fixed-point storage (degrees × 10^7, altitude in cm): integer-only math
+ *   on AVR and no float precision loss at large longitudes
+ * - Motion mode: constant-velocity alpha-beta filter while ground speed shows
+ *   movement, so vehicle installations do not lag the window length behind
  * 
  * Algorithm:
  * 1. Collect last N GPS readings in circular buffers
- * 2. Sort readings to find median values
+ * 2. Keep a sorted copy of each window: remove the oldest reading and
+ *    insert the newest one in place (O(n) per reading instead of O(n²) sorts)
  * 3. Remove top/bottom 20% outliers (if enough readings)
- * 4. Average remaining middle values for final result
+ * 4. Average remaining middle values and cache the result
+ * 
+ * While moving, each reading instead updates an alpha-beta track per
+ * coordinate (predict with the estimated velocity, correct by a fixed share
+ * of the residual), which costs O(1) and follows the position without lag.
+ * The window is restarted on motion, so stale stationary readings never mix
+ * with the new position.
  * 
- * @note Memory usage: 12 readings × 3 coordinates × 4 bytes + 2 counters = 146 bytes
- * @note This represents only 7% of Arduino Nano's 2KB SRAM
+ * @note Memory usage: 12 readings × 3 coordinates × 2 buffers × 4 bytes
+ *       + 3 cached results × 4 bytes + 3 tracks × 8 bytes + state = 334 bytes
  */
 class GpsStabilityFilter {
 public:
@@ -65,9 +129,9 @@ public:
   
   /**
    * @brief Constructor for GpsStabilityFilter
-   * @param gps Reference to the TinyGPSPlus GPS module object
+   * @param gps Reference to the GPS receiver object
    */
-  GpsStabilityFilter(TinyGPSPlus& gps);
+  GpsStabilityFilter(GpsReceiver& gps);
   
   // ========================================================================
   // PUBLIC METHODS
@@ -77,7 +141,8 @@ public:
    * @brief Update GPS stability filter with new coordinate readings
    * 
    * This method adds new GPS readings to the stability filter buffers using
-   * a FIFO (First In, First Out) approach. Should be called whenever new
+   * a FIFO (First In, First Out) approach, updates the sorted windows and
+   * recomputes the cached filtered values. Should be called whenever new
    * valid GPS location data is available.
    * 
    * @note Automatically manages buffer overflow using circular buffer approach
@@ -88,34 +153,51 @@ public:
   /**
    * @brief Get filtered latitude value using hybrid median+average filter
    * 
-   * This method applies a hybrid filtering approach:
-   * 1. Creates a working copy of recent latitude readings
-   * 2. Sorts the values to find the median (removes outliers)
-   * 3. Calculates average of the middle values for final result
+   * Returns the trimmed mean of the latitude window cached by update().
    * 
-   * @return Filtered latitude value, or raw GPS value if insufficient data
+   * @return Filtered latitude in degrees × 10^7, or raw GPS value if insufficient data
    */
-  float getFilteredLatitude();
+  int32_t getFilteredLatitudeE7();
   
   /**
    * @brief Get filtered longitude value using hybrid median+average filter
    * 
-   * This method applies the same hybrid filtering approach as getFilteredLatitude()
-   * but operates on longitude readings from the GPS filter buffer.
+   * Returns the trimmed mean of the longitude window cached by update().
    * 
-   * @return Filtered longitude value, or raw GPS value if insufficient data
+   * @return Filtered longitude in degrees × 10^7, or raw GPS value if insufficient data
    */
-  float getFilteredLongitude();
+  int32_t getFilteredLongitudeE7();
   
   /**
    * @brief Get filtered altitude value using hybrid median+average filter
    * 
-   * This method applies the same hybrid filtering approach as other coordinate
-   * filtering functions but operates on altitude readings in feet.
+   * Returns the trimmed mean of the altitude window cached by update().
    * 
-   * @return Filtered altitude value, or raw GPS value if insufficient data
+   * @return Filtered altitude in centimeters, or raw GPS value if insufficient data
    */
-  float getFilteredAltitude();
+  int32_t getFilteredAltitudeCm();
+  
+  /**
+   * @brief Select the filter strategy
+   * @param strategy Trimmed mean, alpha-beta, or automatic selection by speed
+   */
+  void setStrategy(GpsFilterStrategy strategy);
+  
+  /**
+   * @brief Check if the last reading was filtered in motion mode
+   * @return True if the alpha-beta filter provides the current values
+   */
+  bool isMoving() const { return moving; }
+
+  /**
+   * @brief Check if the filter has produced a position
+   *
+   * Unlike getTotalReadings(), which restarts at 0 in motion mode, this
+   * stays true in both modes once a reading has been filtered.
+   *
+   * @return True if the getters return filtered values
+   */
+  bool hasFilteredPosition() const { return filteredReady; }
   
   /**
    * @brief Get the total number of readings collected so far
@@ -129,16 +211,55 @@ private:
   // ========================================================================
   
   /** Reference to the GPS module object */
-  TinyGPSPlus& gpsModule;
+  GpsReceiver& gpsModule;
   
   /** Latitude readings buffer (circular buffer) */
-  float latReadings[GPS_FILTER_WINDOW_SIZE];
+  int32_t latReadings[GPS_FILTER_WINDOW_SIZE];
   
   /** Longitude readings buffer (circular buffer) */
-  float lonReadings[GPS_FILTER_WINDOW_SIZE];
+  int32_t lonReadings[GPS_FILTER_WINDOW_SIZE];
   
   /** Altitude readings buffer (circular buffer) */
-  float altReadings[GPS_FILTER_WINDOW_SIZE];
+  int32_t altReadings[GPS_FILTER_WINDOW_SIZE];
+  
+  /** Latitude readings sorted in ascending order */
+  int32_t latSorted[GPS_FILTER_WINDOW_SIZE];
+  
+  /** Longitude readings sorted in ascending order */
+  int32_t lonSorted[GPS_FILTER_WINDOW_SIZE];
+  
+  /** Altitude readings sorted in ascending order */
+  int32_t altSorted[GPS_FILTER_WINDOW_SIZE];
+  
+  /** Cached filtered latitude (valid once enough readings are collected) */
+  int32_t filteredLat;
+  
+  /** Cached filtered longitude */
+  int32_t filteredLon;
+  
+  /** Cached filtered altitude (centimeters) */
+  int32_t filteredAlt;
+  
+  /** Alpha-beta track of the latitude */
+  GpsTrack latTrack;
+  
+  /** Alpha-beta track of the longitude */
+  GpsTrack lonTrack;
+  
+  /** Alpha-beta track of the altitude */
+  GpsTrack altTrack;
+  
+  /** Timestamp of the last accepted reading */
+  unsigned long lastUpdateTime;
+  
+  /** Selected filter strategy */
+  GpsFilterStrategy strategy;
+  
+  /** True while motion mode is active */
+  bool moving;
+  
+  /** True once the cached filtered values hold at least one reading */
+  bool filteredReady;
   
   /** Current insertion index for FIFO circular buffer */
   uint8_t currentIndex;
@@ -151,15 +272,52 @@ private:
   // ========================================================================
   
   /**
-   * @brief Helper function to sort an array of float values (for median calculation)
+   * @brief Replace one value in a sorted array, keeping it sorted
+   * 
+   * Removes oldValue (if the window is full) and inserts newValue at its
+   * sorted position, shifting only the elements in between.
+   * 
+   * @param sorted Sorted array of readings
+   * @param count Number of readings in the array before the update
+   * @param oldValue Reading leaving the window (ignored if count < window size)
+   * @param newValue Reading entering the window
+   */
+  void replaceSorted(int32_t sorted[], uint8_t count, int32_t oldValue, int32_t newValue);
+  
+  /**
+   * @brief Decide between motion and stationary mode from the ground speed
+   * @return True if the alpha-beta filter should provide the values
+   */
+  bool detectMotion();
+  
+  /**
+   * @brief Add one reading to the trimmed-mean windows and cache the result
+   * @param lat Latitude reading (degrees × 10^7)
+   * @param lon Longitude reading (degrees × 10^7)
+   * @param alt Altitude reading (centimeters)
+   */
+  void updateWindows(int32_t lat, int32_t lon, int32_t alt);
+  
+  /**
+   * @brief Advance an alpha-beta track by one reading
+   * @param track Track to update
+   * @param measurement New reading
+   * @param elapsedMs Time since the previous reading (milliseconds)
+   */
+  void updateTrack(GpsTrack& track, int32_t measurement, unsigned long elapsedMs);
+  
+  /**
+   * @brief Calculate the trimmed mean of a sorted array
    * 
-   * This function performs a simple bubble sort on a small array of float values.
-   * Used internally by the GPS filtering functions to calculate median values.
+   * Averages the middle 60% of the values if more than 5 readings are
+   * available, otherwise all values. Values are summed as offsets from the
+   * smallest one, so the accumulator stays within 32 bits.
    * 
-   * @param arr Array of float values to sort
-   * @param n Number of elements in the array
+   * @param sorted Sorted array of readings
+   * @param count Number of readings in the array
+   * @return Average of the middle values
    */
-  void sortFloatArray(float arr[], uint8_t n);
+  int32_t trimmedMean(const int32_t sorted[], uint8_t count);
 };
 
 #endif // GPS_STABILITY_FILTER_H
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ * @file LightSensor.cpp
+ * @brief Implementation of the LightSensor class for ambient brightness control
+ *
+ * This file contains the implementation of the LightSensor class, which
+ * smooths LDR readings and maps them to an intensity level with hysteresis.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "LightSensor.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for LightSensor
+ * @param analogPin Analog input with the LDR divider
+ * @param minLevel Level used in darkness
+ * @param maxLevel Level used in full light
+ */
+LightSensor::LightSensor(uint8_t analogPin, uint8_t minLevel, uint8_t maxLevel)
+  : pin(analogPin), minLevel(minLevel), maxLevel(maxLevel),
+    currentLevel(minLevel), smoothedReading(0) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Seed the average with a first reading and pick the initial level
+ */
+void LightSensor::begin() {
+  uint16_t raw = analogRead(pin);
+  smoothedReading = raw << SMOOTHING_SHIFT;
+
+  // Plain mapping, no hysteresis for the first level
+  currentLevel = minLevel;
+  while (currentLevel < maxLevel && raw >= levelStart(currentLevel + 1)) {
+    currentLevel++;
+  }
+}
+
+/**
+ * @brief Take one reading and update the level
+ * @return True if the level changed
+ *
+ * The level moves up only once the smoothed reading is HYSTERESIS_COUNTS
+ * past the start of the next level, and down only once it is that far
+ * below the start of the current one.
+ */
+bool LightSensor::update() {
+  uint16_t raw = analogRead(pin);
+
+  // Exponential moving average: avg += (raw - avg) / 2^SMOOTHING_SHIFT
+  smoothedReading = smoothedReading - (smoothedReading >> SMOOTHING_SHIFT) + raw;
+  uint16_t smoothed = smoothedReading >> SMOOTHING_SHIFT;
+
+  uint8_t previousLevel = currentLevel;
+  while (currentLevel < maxLevel && smoothed >= levelStart(currentLevel + 1) + HYSTERESIS_COUNTS) {
+    currentLevel++;
+  }
+  while (currentLevel > minLevel && smoothed + HYSTERESIS_COUNTS < levelStart(currentLevel)) {
+    currentLevel--;
+  }
+
+  return currentLevel != previousLevel;
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Reading at which the range of a level starts
+ * @param level Level between minLevel and maxLevel
+ * @return Lower edge of the level in ADC counts
+ *
+ * The ADC range is split into equal bands, one per level.
+ */
+uint16_t LightSensor::levelStart(uint8_t level) const {
+  uint8_t levels = maxLevel - minLevel + 1;
+  return (uint32_t)(level - minLevel) * ADC_RANGE / levels;
+}
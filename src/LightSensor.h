@@ -0,0 +1,127 @@
+/**
+ * @file LightSensor.h
+ * @brief Ambient light sensor (LDR) brightness control
+ *
+ * This file contains the LightSensor class that samples an LDR voltage
+ * divider on an analog pin, smooths the readings and turns them into an LED
+ * matrix intensity level with hysteresis.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef LIGHT_SENSOR_H
+#define LIGHT_SENSOR_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// LIGHT SENSOR CLASS
+// ============================================================================
+
+/**
+ * @class LightSensor
+ * @brief Maps ambient light to a display intensity level
+ *
+ * Expected wiring: LDR from 5V to the analog pin and a resistor (e.g. 10k)
+ * from the pin to GND, so brighter light gives a higher reading.
+ *
+ * Features:
+ * - Exponential moving average of the readings, integer only
+ * - Linear mapping of the smoothed reading onto a level range
+ * - Hysteresis around each level boundary, so the level doesn't flicker
+ *   between two values in steady light
+ * - update() reports level changes only, so the caller can skip redundant
+ *   intensity commands
+ */
+class LightSensor {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for LightSensor
+   * @param analogPin Analog input with the LDR divider
+   * @param minLevel Level used in darkness
+   * @param maxLevel Level used in full light
+   */
+  LightSensor(uint8_t analogPin, uint8_t minLevel, uint8_t maxLevel);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Seed the average with a first reading and pick the initial level
+   */
+  void begin();
+
+  /**
+   * @brief Take one reading and update the level
+   * @return True if the level changed
+   * @note Call at a fixed interval; the smoothing time constant is
+   *       2^SMOOTHING_SHIFT sample intervals
+   */
+  bool update();
+
+  /**
+   * @brief Get the current intensity level
+   * @return Level between minLevel and maxLevel
+   */
+  uint8_t level() const { return currentLevel; }
+
+  /**
+   * @brief Get the smoothed reading
+   * @return Reading in ADC counts (0-1023)
+   */
+  uint16_t reading() const { return smoothedReading >> SMOOTHING_SHIFT; }
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Smoothing factor: each reading moves the average by 1/2^SMOOTHING_SHIFT */
+  static const uint8_t SMOOTHING_SHIFT = 4;
+
+  /** Distance past a level boundary before the level changes (ADC counts) */
+  static const uint16_t HYSTERESIS_COUNTS = 24;
+
+  /** ADC full scale (10 bits) */
+  static const uint16_t ADC_RANGE = 1024;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Analog input pin */
+  uint8_t pin;
+
+  /** Level in darkness */
+  uint8_t minLevel;
+
+  /** Level in full light */
+  uint8_t maxLevel;
+
+  /** Current level */
+  uint8_t currentLevel;
+
+  /** Smoothed reading, scaled by 2^SMOOTHING_SHIFT */
+  uint16_t smoothedReading;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Reading at which the range of a level starts
+   * @param level Level between minLevel and maxLevel
+   * @return Lower edge of the level in ADC counts
+   */
+  uint16_t levelStart(uint8_t level) const;
+};
+
+#endif // LIGHT_SENSOR_H
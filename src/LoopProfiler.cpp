@@ -0,0 +1,128 @@
+/**
+ * @file LoopProfiler.cpp
+ * @brief Implementation of the LoopProfiler class for on-device profiling
+ *
+ * This file contains the implementation of the LoopProfiler class, which
+ * accumulates loop() timing statistics and prints them over serial.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "LoopProfiler.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for LoopProfiler
+ * @param frameBudgetMicros Iterations longer than this count as frame overruns
+ * @param colonPeriodMs Nominal time between colon toggles
+ */
+LoopProfiler::LoopProfiler(unsigned long frameBudgetMicros, unsigned long colonPeriodMs)
+  : frameBudget(frameBudgetMicros), iterationStart(0), colonPeriod(colonPeriodMs * 1000UL),
+    lastColonToggle(0), idleStartMicros(0), iterationIdle(0), colonVisible(false) {
+  resetInterval();
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Mark the start of a loop() iteration
+ *
+ * The first call only starts the measurement. Idle sleep within the
+ * iteration is not counted.
+ */
+void LoopProfiler::loopStart() {
+  unsigned long currentMicros = micros();
+
+  if (iterationStart != 0) {
+    unsigned long iteration = currentMicros - iterationStart - iterationIdle;
+    if (iteration < minIteration) minIteration = iteration;
+    if (iteration > maxIteration) maxIteration = iteration;
+    totalIteration += iteration;
+    iterations++;
+    if (iteration > frameBudget && overruns < 0xFFFF) overruns++;
+  }
+
+  iterationStart = currentMicros;
+  iterationIdle = 0;
+}
+
+/**
+ * @brief Mark the end of an idle sleep started with idleStart()
+ */
+void LoopProfiler::idleEnd() {
+  unsigned long idle = micros() - idleStartMicros;
+  iterationIdle += idle;
+  totalIdle += idle;
+}
+
+/**
+ * @brief Record the colon state drawn for a display update
+ * @param visible Colon state being drawn
+ */
+void LoopProfiler::recordColon(bool visible) {
+  if (visible == colonVisible) return;
+  colonVisible = visible;
+
+  unsigned long currentMicros = micros();
+  unsigned long interval = currentMicros - lastColonToggle;
+
+  if (lastColonToggle != 0 && interval < 2 * colonPeriod) {
+    unsigned long jitter = interval > colonPeriod ? interval - colonPeriod : colonPeriod - interval;
+    if (jitter > maxColonJitter) maxColonJitter = jitter;
+  }
+
+  lastColonToggle = currentMicros;
+}
+
+/**
+ * @brief Print the loop statistics and start a new interval
+ * @param output Destination, e.g. Serial
+ */
+void LoopProfiler::printStats(Print& output) {
+  unsigned long elapsedMs = millis() - intervalStart;
+
+  output.print(F("loop:"));
+  output.print(iterations ? minIteration : 0);
+  output.print('/');
+  output.print(iterations ? totalIteration / iterations : 0);
+  output.print('/');
+  output.print(maxIteration);
+  output.print(F("us ovr:"));
+  output.print(overruns);
+  output.print(F(" gps:"));
+  output.print(elapsedMs ? parsedBytes * 1000UL / elapsedMs : 0);
+  output.print(F("B/s colon:"));
+  output.print(maxColonJitter);
+  output.print(F("us idle:"));
+  output.print(elapsedMs ? totalIdle / 10UL / elapsedMs : 0);
+  output.print('%');
+
+  resetInterval();
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Clear the statistics at the start of a reporting interval
+ */
+void LoopProfiler::resetInterval() {
+  intervalStart = millis();
+  minIteration = 0xFFFFFFFFUL;
+  maxIteration = 0;
+  totalIteration = 0;
+  iterations = 0;
+  parsedBytes = 0;
+  overruns = 0;
+  maxColonJitter = 0;
+  totalIdle = 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file LoopProfiler.h
+ * @brief Loop timing and throughput statistics for on-device profiling
+ *
+ * This file contains the LoopProfiler class that measures loop() iteration
+ * times, counts frame overruns and GPS bytes parsed, and prints them as a
+ * compact stats line. It is only used when ENABLE_PROFILING is set.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// LOOP PROFILER CLASS
+// ============================================================================
+
+/**
+ * @class LoopProfiler
+ * @brief Collects loop() timing statistics over a reporting interval
+ *
+ * Features:
+ * - Minimum, average and maximum loop() iteration time (microseconds)
+ * - Frame overruns: iterations longer than the frame budget, i.e. an
+ *   animation frame was shown late
+ * - GPS bytes parsed per second
+ * - Colon toggle jitter: largest deviation of the colon blink interval from
+ *   its nominal period
+ * - Share of time spent in idle sleep; iteration times exclude it
+ *
+ * Statistics cover the time since the previous printStats() call.
+ */
+class LoopProfiler {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for LoopProfiler
+   * @param frameBudgetMicros Iterations longer than this count as frame overruns
+   * @param colonPeriodMs Nominal time between colon toggles
+   */
+  LoopProfiler(unsigned long frameBudgetMicros, unsigned long colonPeriodMs);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Mark the start of a loop() iteration
+   *
+   * The time since the previous call is recorded as one iteration.
+   */
+  void loopStart();
+
+  /**
+   * @brief Count GPS bytes handed to the parser
+   * @param count Number of bytes parsed
+   */
+  void addParsedBytes(uint16_t count) { parsedBytes += count; }
+
+  /**
+   * @brief Record the colon state drawn for a display update
+   *
+   * Toggles are timed against the nominal period; gaps over twice the period
+   * (time display paused for scrolling text or rain) are not counted.
+   *
+   * @param visible Colon state being drawn
+   */
+  void recordColon(bool visible);
+
+  /**
+   * @brief Mark the start of an idle sleep
+   */
+  void idleStart() { idleStartMicros = micros(); }
+
+  /**
+   * @brief Mark the end of an idle sleep started with idleStart()
+   */
+  void idleEnd();
+
+  /**
+   * @brief Print the loop statistics and start a new interval
+   *
+   * Prints "loop:<min>/<avg>/<max>us ovr:<overruns> gps:<bytes>B/s
+   * colon:<jitter>us idle:<percent>%" without a line ending, so the caller
+   * can append further fields.
+   *
+   * @param output Destination, e.g. Serial
+   */
+  void printStats(Print& output);
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Iterations longer than this are frame overruns (microseconds) */
+  unsigned long frameBudget;
+
+  /** micros() at the start of the current iteration */
+  unsigned long iterationStart;
+
+  /** millis() at the start of the reporting interval */
+  unsigned long intervalStart;
+
+  /** Shortest iteration in this interval (microseconds) */
+  unsigned long minIteration;
+
+  /** Longest iteration in this interval (microseconds) */
+  unsigned long maxIteration;
+
+  /** Sum of all iteration times in this interval (microseconds) */
+  unsigned long totalIteration;
+
+  /** Iterations measured in this interval */
+  unsigned long iterations;
+
+  /** GPS bytes parsed in this interval */
+  unsigned long parsedBytes;
+
+  /** Nominal time between colon toggles (microseconds) */
+  unsigned long colonPeriod;
+
+  /** micros() at the last colon toggle (0 = none yet) */
+  unsigned long lastColonToggle;
+
+  /** Largest colon toggle deviation in this interval (microseconds) */
+  unsigned long maxColonJitter;
+
+  /** micros() at the start of the current idle sleep */
+  unsigned long idleStartMicros;
+
+  /** Idle sleep time within the current iteration (microseconds) */
+  unsigned long iterationIdle;
+
+  /** Idle sleep time in this interval (microseconds) */
+  unsigned long totalIdle;
+
+  /** Colon state of the last display update */
+  bool colonVisible;
+
+  /** Frame overruns in this interval */
+  uint16_t overruns;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Clear the statistics at the start of a reporting interval
+   */
+  void resetInterval();
+};
+
+#endif // LOOP_PROFILER_H
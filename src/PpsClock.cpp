@@ -0,0 +1,150 @@
+/**
+ * @file PpsClock.cpp
+ * @brief Implementation of the PpsClock class for PPS-aligned second boundaries
+ *
+ * This file contains the implementation of the PpsClock class, which counts
+ * PPS edges from interrupt context and labels them with NMEA time.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "PpsClock.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for PpsClock
+ * @param maxFreewheelSeconds Edges accepted after the last NMEA label before unlocking
+ *
+ * Starts unlocked; the clock locks once edges arrive and one is labelled.
+ */
+PpsClock::PpsClock(uint8_t maxFreewheelSeconds)
+  : edgeCount(0), edgeMicros(0), edgeMillis(0), labelledEdge(0),
+    sentenceEdge(0), sentenceEdgePending(false), labelledUnixTime(0), handledEdge(0), maxFreewheel(maxFreewheelSeconds),
+    displayLatencyMicros(0) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Record a PPS edge
+ *
+ * Kept to two timestamps and a counter so the interrupt stays short.
+ */
+void PpsClock::captureEdge() {
+  edgeMicros = micros();
+  edgeMillis = millis();
+  edgeCount++;
+}
+
+/**
+ * @brief Record the most recent PPS edge for a sentence that just completed
+ *
+ * Receivers send the sentence for second T shortly after the PPS edge that
+ * starts second T, so a sentence completing within LABEL_WINDOW_MS of an
+ * edge belongs to that edge. The edge is taken now rather than when the time
+ * is labelled, since by then the next edge may already have arrived.
+ */
+void PpsClock::captureSentenceEdge() {
+  uint8_t count;
+  unsigned long edgeMs, edgeUs;
+  readEdge(count, edgeMs, edgeUs);
+
+  sentenceEdgePending = count != 0 && (unsigned long)(millis() - edgeMs) <= LABEL_WINDOW_MS;
+  sentenceEdge = count;
+}
+
+/**
+ * @brief Tie the parsed NMEA time to the edge captured for its sentence
+ * @param unixTime UTC time of the NMEA sentence (seconds since 1970)
+ */
+void PpsClock::labelSentenceEdge(uint32_t unixTime) {
+  if (!sentenceEdgePending) return;
+  sentenceEdgePending = false;
+
+  labelledEdge = sentenceEdge;
+  labelledUnixTime = unixTime;
+}
+
+/**
+ * @brief Take a new second boundary, once per PPS edge
+ * @param unixTime Receives the UTC time that started at the edge
+ * @return True if a new edge occurred and the clock is locked
+ *
+ * Edges since the labelled one are added as whole seconds, which keeps the
+ * clock running on the edge even before the new sentence has been parsed.
+ */
+bool PpsClock::takeSecondEdge(uint32_t& unixTime) {
+  uint8_t count;
+  unsigned long edgeMs, edgeUs;
+  readEdge(count, edgeMs, edgeUs);
+
+  if (count == handledEdge || !isLocked()) return false;
+  handledEdge = count;
+
+  unixTime = labelledUnixTime + (uint8_t)(count - labelledEdge);
+  return true;
+}
+
+/**
+ * @brief Check if PPS edges are arriving and have been labelled
+ * @return True if the clock can provide second boundaries
+ */
+bool PpsClock::isLocked() const {
+  uint8_t count;
+  unsigned long edgeMs, edgeUs;
+  readEdge(count, edgeMs, edgeUs);
+
+  if (labelledUnixTime == 0) return false;
+  if ((unsigned long)(millis() - edgeMs) > EDGE_TIMEOUT_MS) return false;
+  return (uint8_t)(count - labelledEdge) <= maxFreewheel;
+}
+
+/**
+ * @brief Get the milliseconds elapsed since the last PPS edge
+ * @return Milliseconds since the last edge
+ */
+unsigned long PpsClock::millisSinceEdge() const {
+  uint8_t count;
+  unsigned long edgeMs, edgeUs;
+  readEdge(count, edgeMs, edgeUs);
+  return millis() - edgeMs;
+}
+
+/**
+ * @brief Record the edge-to-display latency of the current second
+ */
+void PpsClock::markDisplayed() {
+  uint8_t count;
+  unsigned long edgeMs, edgeUs;
+  readEdge(count, edgeMs, edgeUs);
+  displayLatencyMicros = micros() - edgeUs;
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Read the edge counter and timestamps consistently
+ * @param count Receives the edge counter
+ * @param edgeMs Receives millis() at the last edge
+ * @param edgeUs Receives micros() at the last edge
+ *
+ * Interrupts are briefly disabled because 32-bit values cannot be read
+ * atomically on AVR.
+ */
+void PpsClock::readEdge(uint8_t& count, unsigned long& edgeMs, unsigned long& edgeUs) const {
+  noInterrupts();
+  count = edgeCount;
+  edgeMs = edgeMillis;
+  edgeUs = edgeMicros;
+  interrupts();
+}
@@ -0,0 +1,175 @@
+/**
+ * @file PpsClock.h
+ * @brief GPS PPS (pulse per second) disciplined local clock
+ *
+ * This file contains the PpsClock class that latches the PPS second edge in
+ * an interrupt and combines it with the NMEA time of day, so the display can
+ * update exactly on the UTC second boundary instead of on a polling tick.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef PPS_CLOCK_H
+#define PPS_CLOCK_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// PPS CLOCK CLASS
+// ============================================================================
+
+/**
+ * @class PpsClock
+ * @brief Local seconds counter disciplined by the GPS PPS edge
+ *
+ * The PPS interrupt only records the edge time (micros/millis) and counts
+ * edges. NMEA sentences arrive some hundred milliseconds after the edge they
+ * describe; captureSentenceEdge() records the most recent edge at the moment
+ * a time-bearing sentence completes, and labelSentenceEdge() later ties the
+ * parsed time to that edge, however late the display code gets to it. Every
+ * following edge then advances the local clock by one second, whether or
+ * not a sentence has been parsed yet.
+ *
+ * Features:
+ * - Sub-millisecond second boundary (interrupt latency plus micros() resolution)
+ * - Free-running between NMEA sentences for a configured number of seconds
+ * - Edge-to-display latency measurement for diagnostics
+ *
+ * @note captureEdge() runs in interrupt context, everything else in loop()
+ */
+class PpsClock {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for PpsClock
+   * @param maxFreewheelSeconds Edges accepted after the last NMEA label before unlocking
+   */
+  PpsClock(uint8_t maxFreewheelSeconds);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Record a PPS edge
+   * @note Call from the PPS pin interrupt handler only
+   */
+  void captureEdge();
+
+  /**
+   * @brief Record the most recent PPS edge for a sentence that just completed
+   *
+   * Ignored if the sentence completed too long after the edge to belong to it.
+   *
+   * @note Call right after the parser completed a time-bearing sentence
+   */
+  void captureSentenceEdge();
+
+  /**
+   * @brief Check if a captured sentence edge is waiting for its time
+   * @return True after captureSentenceEdge() until labelSentenceEdge()
+   */
+  bool hasSentenceEdge() const { return sentenceEdgePending; }
+
+  /**
+   * @brief Tie the parsed NMEA time to the edge captured for its sentence
+   * @param unixTime UTC time of the NMEA sentence (seconds since 1970)
+   */
+  void labelSentenceEdge(uint32_t unixTime);
+
+  /**
+   * @brief Take a new second boundary, once per PPS edge
+   * @param unixTime Receives the UTC time that started at the edge
+   * @return True if a new edge occurred and the clock is locked
+   */
+  bool takeSecondEdge(uint32_t& unixTime);
+
+  /**
+   * @brief Check if PPS edges are arriving and have been labelled
+   * @return True if the clock can provide second boundaries
+   */
+  bool isLocked() const;
+
+  /**
+   * @brief Get the milliseconds elapsed since the last PPS edge
+   * @return Milliseconds since the last edge
+   */
+  unsigned long millisSinceEdge() const;
+
+  /**
+   * @brief Record the edge-to-display latency of the current second
+   * @note Call right after the display was written for a new second
+   */
+  void markDisplayed();
+
+  /**
+   * @brief Get the last measured edge-to-display latency
+   * @return Latency in microseconds
+   */
+  unsigned long getDisplayLatencyMicros() const { return displayLatencyMicros; }
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** A sentence arriving later than this after an edge is not labelled */
+  static const unsigned long LABEL_WINDOW_MS = 900;
+
+  /** Edges further apart than this mean the PPS signal was lost */
+  static const unsigned long EDGE_TIMEOUT_MS = 1500;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Edge counter, incremented in interrupt context (8-bit for atomic reads) */
+  volatile uint8_t edgeCount;
+
+  /** micros() at the last edge */
+  volatile unsigned long edgeMicros;
+
+  /** millis() at the last edge */
+  volatile unsigned long edgeMillis;
+
+  /** Edge counter value the last NMEA time was tied to */
+  uint8_t labelledEdge;
+
+  /** Edge counter value when the last time-bearing sentence completed */
+  uint8_t sentenceEdge;
+
+  /** sentenceEdge is waiting for labelSentenceEdge() */
+  bool sentenceEdgePending;
+
+  /** UTC time of the labelled edge (0 = not labelled yet) */
+  uint32_t labelledUnixTime;
+
+  /** Edge counter value last returned by takeSecondEdge() */
+  uint8_t handledEdge;
+
+  /** Edges accepted after the last label before unlocking */
+  uint8_t maxFreewheel;
+
+  /** Last measured edge-to-display latency (microseconds) */
+  unsigned long displayLatencyMicros;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Read the edge counter and timestamps consistently
+   * @param count Receives the edge counter
+   * @param edgeMs Receives millis() at the last edge
+   * @param edgeUs Receives micros() at the last edge
+   */
+  void readEdge(uint8_t& count, unsigned long& edgeMs, unsigned long& edgeUs) const;
+};
+
+#endif // PPS_CLOCK_H
@@ -14,6 +14,18 @@
 
 #include "RainEffect.h"
 
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/**
+ * Grey level for each flash intensity (0-15). Flashes never drop below level
+ * 1 before they expire, like the on/off rendering.
+ */
+static const uint8_t FLASH_GREY_LEVEL[16] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3
+};
+
 // ============================================================================
 // CONSTRUCTOR
 // ============================================================================
@@ -21,20 +33,28 @@
 /**
  * @brief Constructor for RainEffect
  * @param matrix Reference to the LED matrix display object
+ * @param maxFps Maximum frames written to the display per second (0 = no cap)
  * 
  * Initializes the rain effect system by setting up the member variables
- * and deactivating all raindrops and ground flashes.
+ * and placing all raindrop and ground flash slots on their free-lists.
  */
-RainEffect::RainEffect(Max72xxPanel& matrix) 
-  : ledMatrix(matrix), lastRaindropSpawnTime(0), isInitializedFlag(false) {
-  // Initialize all raindrops as inactive
-  for (int i = 0; i < MAX_RAINDROPS; i++) {
-    raindropArray[i].isActive = false;
+RainEffect::RainEffect(Max72xxPanel& matrix, uint8_t maxFps) 
+  : ledMatrix(matrix), activeRaindrops(0), activeGroundFlashes(0),
+    freeRaindropHead(0), freeGroundFlashHead(0),
+    frameIntervalMs(maxFps ? 1000 / maxFps : 0), lastFrameTime(0),
+    frameChanged(false), forceFrame(true),
+    lastRaindropSpawnTime(0), isInitializedFlag(false) {
+  static_assert(MAX_RAINDROPS <= 8 * sizeof(ParticleMask), "MAX_RAINDROPS exceeds the active bitmask");
+  static_assert(MAX_GROUND_FLASHES <= 8 * sizeof(ParticleMask), "MAX_GROUND_FLASHES exceeds the active bitmask");
+
+  // Chain all raindrops into the free-list
+  for (uint8_t i = 0; i < MAX_RAINDROPS; i++) {
+    raindropArray[i].nextFree = (i + 1 < MAX_RAINDROPS) ? i + 1 : NO_FREE_SLOT;
   }
   
-  // Initialize all ground flashes as inactive
-  for (int i = 0; i < MAX_GROUND_FLASHES; i++) {
-    groundFlashArray[i].isActive = false;
+  // Chain all ground flashes into the free-list
+  for (uint8_t i = 0; i < MAX_GROUND_FLASHES; i++) {
+    groundFlashArray[i].nextFree = (i + 1 < MAX_GROUND_FLASHES) ? i + 1 : NO_FREE_SLOT;
   }
 }
 
@@ -64,10 +84,12 @@ void RainEffect::initialize() {
  * - Managing ground flash effects
  * 
  * Should be called every loop iteration for smooth animation.
+ * 
+ * @return True if the picture changed since the last rendered frame
  */
-void RainEffect::update() {
+bool RainEffect::update() {
   // Exit early if not initialized
-  if (!isInitializedFlag) return;
+  if (!isInitializedFlag) return false;
   
   unsigned long currentTime = millis();
 
@@ -75,92 +97,92 @@ void RainEffect::update() {
   if ((unsigned long)(currentTime - lastRaindropSpawnTime) >= RAIN_SPAWN_INTERVAL_MS) {
     // Add 70% probability to make spawning more natural and less predictable
     if (random(100) < 70) {
+      ParticleMask previousRaindrops = activeRaindrops;
       spawnNewRaindrop();
+      if (activeRaindrops != previousRaindrops) frameChanged = true;
     }
     lastRaindropSpawnTime = currentTime;
   }
   
   // Update all active raindrops and ground flashes
-  updateFallingRaindrops();
-  updateGroundImpactFlashes();
+  if (updateFallingRaindrops()) frameChanged = true;
+  if (updateGroundImpactFlashes()) frameChanged = true;
+
+  return frameChanged || forceFrame;
 }
 
 /**
  * @brief Render the rain effect to the LED matrix
  * 
  * This method draws all active raindrops and ground flashes to the LED matrix.
- * It includes optimizations to only clear and redraw when there are active
- * elements, improving performance.
+ * Nothing is drawn or written unless the picture changed, and frames are
+ * spaced at least frameIntervalMs apart. A frame is also drawn when the
+ * last element disappears, so the display ends up blank.
  */
 void RainEffect::render() {
   // Exit early if not initialized
   if (!isInitializedFlag) return;
   
-  // Optimization: Only clear screen if there are active elements to draw
-  bool hasActiveElements = false;
-  
-  // Check if there are any active raindrops
-  for (int raindropIndex = 0; raindropIndex < MAX_RAINDROPS; raindropIndex++) {
-    if (raindropArray[raindropIndex].isActive) {
-      hasActiveElements = true;
-      break;
+  // Only clear and redraw if something visibly changed
+  if (!frameChanged && !forceFrame) return;
+
+  // Frame-rate cap: keep the change pending until the next frame is due
+  unsigned long currentTime = millis();
+  if (!forceFrame && (unsigned long)(currentTime - lastFrameTime) < frameIntervalMs) return;
+  lastFrameTime = currentTime;
+  frameChanged = false;
+  forceFrame = false;
+
+  // Clear the display
+  ledMatrix.fillScreen(LOW);
+
+  // Draw all active raindrops (the loop ends after the highest active slot)
+  uint8_t raindropIndex = 0;
+  for (ParticleMask pending = activeRaindrops; pending != 0; pending >>= 1, raindropIndex++) {
+    if (pending & 1) {
+      ledMatrix.drawPixel(raindropArray[raindropIndex].positionX, 
+                         raindropArray[raindropIndex].positionY, HIGH);
     }
   }
-  
-  // Check if there are any active ground flashes
-  if (!hasActiveElements) {
-    for (int flashIndex = 0; flashIndex < MAX_GROUND_FLASHES; flashIndex++) {
-      if (groundFlashArray[flashIndex].isActive) {
-        hasActiveElements = true;
-        break;
+
+  // Draw all ground flashes with visual effects
+  int groundYPosition = ledMatrix.height() - 1;
+  uint8_t flashIndex = 0;
+  for (ParticleMask pending = activeGroundFlashes; pending != 0; pending >>= 1, flashIndex++) {
+    if (!(pending & 1)) continue;
+    const GroundFlash& flash = groundFlashArray[flashIndex];
+    uint8_t level = FLASH_GREY_LEVEL[flash.brightnessIntensity & 0x0F];
+
+    // Draw main flash point at ground level (bottom row)
+    ledMatrix.drawGreyPixel(flash.positionX, groundYPosition, level);
+
+    // Draw spread effect for more dramatic flash (high intensity)
+    if (flash.brightnessIntensity > FLASH_SPREAD_INTENSITY) {
+      // Left spread
+      if (flash.positionX > 0) {
+        ledMatrix.drawGreyPixel(flash.positionX - 1, groundYPosition, level);
       }
-    }
-  }
-  
-  // Only clear and redraw if there are active elements
-  if (hasActiveElements) {
-    // Clear the display
-    ledMatrix.fillScreen(LOW);
-
-    // Draw all active raindrops
-    for (int raindropIndex = 0; raindropIndex < MAX_RAINDROPS; raindropIndex++) {
-      if (raindropArray[raindropIndex].isActive) {
-        ledMatrix.drawPixel(raindropArray[raindropIndex].positionX, 
-                           raindropArray[raindropIndex].positionY, HIGH);
+      // Right spread
+      if (flash.positionX < ledMatrix.width() - 1) {
+        ledMatrix.drawGreyPixel(flash.positionX + 1, groundYPosition, level);
       }
     }
 
-    // Draw all ground flashes with visual effects
-    for (int flashIndex = 0; flashIndex < MAX_GROUND_FLASHES; flashIndex++) {
-      if (groundFlashArray[flashIndex].isActive) {
-        // Draw flash at ground level (bottom row)
-        int groundYPosition = ledMatrix.height() - 1;
-
-        // Draw main flash point
-        ledMatrix.drawPixel(groundFlashArray[flashIndex].positionX, groundYPosition, HIGH);
-
-        // Draw spread effect for more dramatic flash (high intensity)
-        if (groundFlashArray[flashIndex].brightnessIntensity > 8) {
-          // Left spread
-          if (groundFlashArray[flashIndex].positionX > 0) {
-            ledMatrix.drawPixel(groundFlashArray[flashIndex].positionX - 1, groundYPosition, HIGH);
-          }
-          // Right spread
-          if (groundFlashArray[flashIndex].positionX < ledMatrix.width() - 1) {
-            ledMatrix.drawPixel(groundFlashArray[flashIndex].positionX + 1, groundYPosition, HIGH);
-          }
-        }
-
-        // Draw upward splash effect (medium intensity)
-        if (groundFlashArray[flashIndex].brightnessIntensity > 4 && groundYPosition > 0) {
-          ledMatrix.drawPixel(groundFlashArray[flashIndex].positionX, groundYPosition - 1, HIGH);
-        }
-      }
+    // Draw upward splash effect (medium intensity)
+    if (flash.brightnessIntensity > FLASH_SPLASH_INTENSITY && groundYPosition > 0) {
+      ledMatrix.drawGreyPixel(flash.positionX, groundYPosition - 1, level);
     }
-
-    // Update the display
-    ledMatrix.write();
   }
+
+  // Update the display
+  ledMatrix.write();
+}
+
+/**
+ * @brief Redraw the whole effect on the next render(), ignoring the frame cap
+ */
+void RainEffect::invalidate() {
+  forceFrame = true;
 }
 
 // ============================================================================
@@ -170,25 +192,47 @@ void RainEffect::render() {
 /**
  * @brief Spawn a new raindrop at the top of the display
  * 
- * Finds an available raindrop slot and initializes it with:
+ * Takes the first slot of the free-list and initializes it with:
  * - Random X position across the display width
  * - Y position at the top (0)
  * - Random fall speed within the configured range
- * - Current timestamp for movement timing
+ * - Current tick for movement timing
+ * 
+ * Nothing is spawned while all raindrop slots are in use.
  */
 void RainEffect::spawnNewRaindrop() {
-  // Find an inactive raindrop slot
-  for (int raindropIndex = 0; raindropIndex < MAX_RAINDROPS; raindropIndex++) {
-    if (!raindropArray[raindropIndex].isActive) {
-      // Initialize raindrop properties
-      raindropArray[raindropIndex].positionX = random(ledMatrix.width());
-      raindropArray[raindropIndex].positionY = 0;  // Start at top of display
-      raindropArray[raindropIndex].fallSpeedMs = random(RAIN_FALL_SPEED_MIN_MS, RAIN_FALL_SPEED_MAX_MS + 1);
-      raindropArray[raindropIndex].isActive = true;
-      raindropArray[raindropIndex].lastMoveTime = millis();
-      break;
-    }
-  }
+  uint8_t raindropIndex = freeRaindropHead;
+  if (raindropIndex == NO_FREE_SLOT) return;
+
+  RainDrop& raindrop = raindropArray[raindropIndex];
+  freeRaindropHead = raindrop.nextFree;
+
+  // Initialize raindrop properties
+  raindrop.positionX = random(ledMatrix.width());
+  raindrop.positionY = 0;  // Start at top of display
+  raindrop.fallSpeedMs = random(RAIN_FALL_SPEED_MIN_MS, RAIN_FALL_SPEED_MAX_MS + 1);
+  raindrop.lastMoveTick = (uint16_t)millis();
+  activeRaindrops |= (ParticleMask)1 << raindropIndex;
+}
+
+/**
+ * @brief Deactivate a raindrop and return its slot to the free-list
+ * @param raindropIndex Slot to release
+ */
+void RainEffect::releaseRaindrop(uint8_t raindropIndex) {
+  activeRaindrops &= ~((ParticleMask)1 << raindropIndex);
+  raindropArray[raindropIndex].nextFree = freeRaindropHead;
+  freeRaindropHead = raindropIndex;
+}
+
+/**
+ * @brief Deactivate a ground flash and return its slot to the free-list
+ * @param flashIndex Slot to release
+ */
+void RainEffect::releaseGroundFlash(uint8_t flashIndex) {
+  activeGroundFlashes &= ~((ParticleMask)1 << flashIndex);
+  groundFlashArray[flashIndex].nextFree = freeGroundFlashHead;
+  freeGroundFlashHead = flashIndex;
 }
 
 /**
@@ -197,32 +241,38 @@ void RainEffect::spawnNewRaindrop() {
  * This method moves all active raindrops down the display based on their
  * individual fall speeds. When a raindrop reaches the bottom, it creates
  * a ground impact flash and deactivates the raindrop.
+ * 
+ * @return True if any raindrop moved
  */
-void RainEffect::updateFallingRaindrops() {
-  unsigned long currentTime = millis();
+bool RainEffect::updateFallingRaindrops() {
+  bool moved = false;
+  uint16_t currentTick = (uint16_t)millis();
+  int displayHeight = ledMatrix.height();
 
   // Update each active raindrop
-  for (int raindropIndex = 0; raindropIndex < MAX_RAINDROPS; raindropIndex++) {
-    if (raindropArray[raindropIndex].isActive) {
-      // Check if it's time to move this raindrop based on its fall speed
-      if ((unsigned long)(currentTime - raindropArray[raindropIndex].lastMoveTime) >= 
-          (unsigned long)raindropArray[raindropIndex].fallSpeedMs) {
-        
-        // Move raindrop down one pixel
-        raindropArray[raindropIndex].positionY++;
-        raindropArray[raindropIndex].lastMoveTime = currentTime;
-
-        // Check if raindrop hit the ground (bottom of display)
-        if (raindropArray[raindropIndex].positionY >= ledMatrix.height()) {
-          // Create ground impact flash effect
-          createGroundImpactFlash(raindropArray[raindropIndex].positionX);
-
-          // Deactivate this raindrop
-          raindropArray[raindropIndex].isActive = false;
-        }
-      }
+  uint8_t raindropIndex = 0;
+  for (ParticleMask pending = activeRaindrops; pending != 0; pending >>= 1, raindropIndex++) {
+    if (!(pending & 1)) continue;
+    RainDrop& raindrop = raindropArray[raindropIndex];
+
+    // Check if it's time to move this raindrop based on its fall speed
+    if ((uint16_t)(currentTick - raindrop.lastMoveTick) < raindrop.fallSpeedMs) continue;
+
+    // Move raindrop down one pixel
+    raindrop.positionY++;
+    raindrop.lastMoveTick = currentTick;
+    moved = true;
+
+    // Check if raindrop hit the ground (bottom of display)
+    if (raindrop.positionY >= displayHeight) {
+      // Create ground impact flash effect
+      createGroundImpactFlash(raindrop.positionX);
+
+      // Deactivate this raindrop (pending holds a copy, so the loop is unaffected)
+      releaseRaindrop(raindropIndex);
     }
   }
+  return moved;
 }
 
 /**
@@ -231,37 +281,36 @@ void RainEffect::updateFallingRaindrops() {
  * 
  * Creates a visual flash effect when a raindrop hits the ground.
  * The flash starts at maximum brightness and fades out over time.
+ * When all slots are in use the oldest flash is replaced.
  */
-void RainEffect::createGroundImpactFlash(int xPosition) {
-  int availableIndex = -1;
-  int oldestIndex = 0;
-  unsigned long oldestTime = millis(); // Start with current time
-  
-  // First, try to find an inactive ground flash slot
-  for (int flashIndex = 0; flashIndex < MAX_GROUND_FLASHES; flashIndex++) {
-    if (!groundFlashArray[flashIndex].isActive) {
-      availableIndex = flashIndex;
-      break;
-    } else {
-      // Track the oldest active flash in case we need to replace it
-      if (groundFlashArray[flashIndex].flashStartTime <= oldestTime) {
-        oldestTime = groundFlashArray[flashIndex].flashStartTime;
-        oldestIndex = flashIndex;
+void RainEffect::createGroundImpactFlash(uint8_t xPosition) {
+  uint16_t currentTick = (uint16_t)millis();
+  uint8_t useIndex = freeGroundFlashHead;
+
+  if (useIndex != NO_FREE_SLOT) {
+    // Take the first free slot
+    freeGroundFlashHead = groundFlashArray[useIndex].nextFree;
+    activeGroundFlashes |= (ParticleMask)1 << useIndex;
+  } else {
+    // Pool full: replace the oldest active flash
+    uint16_t oldestAge = 0;
+    useIndex = 0;
+    for (uint8_t flashIndex = 0; flashIndex < MAX_GROUND_FLASHES; flashIndex++) {
+      uint16_t age = currentTick - groundFlashArray[flashIndex].flashStartTick;
+      if (age >= oldestAge) {
+        oldestAge = age;
+        useIndex = flashIndex;
       }
     }
   }
   
-  // Use available slot, or replace the oldest active flash
-  int useIndex = (availableIndex != -1) ? availableIndex : oldestIndex;
-  
   // Initialize ground flash properties
-  groundFlashArray[useIndex].positionX = xPosition;
+  GroundFlash& flash = groundFlashArray[useIndex];
+  flash.positionX = xPosition;
   // Add some variation to flash intensity (10-15) for more realism
-  int initialIntensity = random(10, 16);
-  groundFlashArray[useIndex].brightnessIntensity = initialIntensity;
-  groundFlashArray[useIndex].initialIntensity = initialIntensity;
-  groundFlashArray[useIndex].flashStartTime = millis();
-  groundFlashArray[useIndex].isActive = true;
+  flash.initialIntensity = random(10, 16);
+  flash.brightnessIntensity = flash.initialIntensity;
+  flash.flashStartTick = currentTick;
 }
 
 /**
@@ -269,32 +318,51 @@ void RainEffect::createGroundImpactFlash(int xPosition) {
  * 
  * This method updates the brightness of all active ground flashes
  * based on their age. Flashes fade out over time and are deactivated
- * when their duration expires.
+ * when their duration expires. Only expiry and intensity changes that
+ * alter the drawn shape or grey level count as a visible change.
+ * 
+ * @return True if any flash changed shape, grey level or expired
  */
-void RainEffect::updateGroundImpactFlashes() {
-  unsigned long currentTime = millis();
+bool RainEffect::updateGroundImpactFlashes() {
+  uint16_t currentTick = (uint16_t)millis();
+  bool changed = false;
 
   // Update each active ground flash
-  for (int flashIndex = 0; flashIndex < MAX_GROUND_FLASHES; flashIndex++) {
-    if (groundFlashArray[flashIndex].isActive) {
-      unsigned long elapsedTime = (unsigned long)(currentTime - groundFlashArray[flashIndex].flashStartTime);
-
-      // Check if flash duration has expired
-      if (elapsedTime >= GROUND_FLASH_DURATION_MS) {
-        // Flash duration expired, deactivate
-        groundFlashArray[flashIndex].isActive = false;
-      } else {
-        // Calculate fade intensity (fade out over time)
-        // Safety check to prevent division by zero
-        if (GROUND_FLASH_DURATION_MS > 0) {
-          float fadeRatio = 1.0 - (float)elapsedTime / GROUND_FLASH_DURATION_MS;
-          // Use stored initial intensity for proper fading
-          groundFlashArray[flashIndex].brightnessIntensity = (int)(groundFlashArray[flashIndex].initialIntensity * fadeRatio);
-        } else {
-          // Fallback: set to stored initial intensity if duration is invalid
-          groundFlashArray[flashIndex].brightnessIntensity = groundFlashArray[flashIndex].initialIntensity;
-        }
-      }
+  uint8_t flashIndex = 0;
+  for (ParticleMask pending = activeGroundFlashes; pending != 0; pending >>= 1, flashIndex++) {
+    if (!(pending & 1)) continue;
+    GroundFlash& flash = groundFlashArray[flashIndex];
+    uint16_t elapsedTime = currentTick - flash.flashStartTick;
+
+    // Check if flash duration has expired
+    if (elapsedTime >= GROUND_FLASH_DURATION_MS) {
+      // Flash duration expired, deactivate
+      releaseGroundFlash(flashIndex);
+      changed = true;
+    } else {
+      // Fade out linearly from the stored initial intensity
+      uint8_t previousAppearance = flashAppearance(flash.brightnessIntensity);
+      flash.brightnessIntensity = (uint16_t)flash.initialIntensity *
+                                  (GROUND_FLASH_DURATION_MS - elapsedTime) / GROUND_FLASH_DURATION_MS;
+      if (flashAppearance(flash.brightnessIntensity) != previousAppearance) changed = true;
     }
   }
+  return changed;
+}
+
+/**
+ * @brief Summarize how a ground flash is drawn at an intensity
+ * @param intensity Flash brightness intensity
+ * @return Shape in bits 0-1, grey level in bits 2-3 (greyscale mode only)
+ */
+uint8_t RainEffect::flashAppearance(uint8_t intensity) const {
+  uint8_t shape = 0;
+  if (intensity > FLASH_SPREAD_INTENSITY) {
+    shape = 2;
+  } else if (intensity > FLASH_SPLASH_INTENSITY) {
+    shape = 1;
+  }
+
+  if (!ledMatrix.isGreyscale()) return shape;
+  return shape | (FLASH_GREY_LEVEL[intensity & 0x0F] << 2);
 }
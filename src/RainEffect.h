@@ -28,14 +28,17 @@
  * @brief Represents a single raindrop in the rain animation
  * 
  * This structure holds all the necessary data for a single raindrop including
- * its position, movement speed, and state information.
+ * its position, movement speed, and timing. Fields are byte-sized and times
+ * are 16-bit millisecond ticks, so a drop takes 6 bytes of SRAM.
  */
 struct RainDrop {
-  int positionX;           /**< X coordinate of the raindrop */
-  int positionY;           /**< Y coordinate of the raindrop */
-  int fallSpeedMs;         /**< Time in milliseconds between each fall movement */
-  bool isActive;           /**< Whether this raindrop is currently active */
-  unsigned long lastMoveTime; /**< Timestamp of the last movement */
+  uint8_t positionX;       /**< X coordinate of the raindrop */
+  union {
+    uint8_t positionY;     /**< Y coordinate of the raindrop (while active) */
+    uint8_t nextFree;      /**< Next free slot in the free-list (while inactive) */
+  };
+  uint8_t fallSpeedMs;     /**< Time in milliseconds between each fall movement */
+  uint16_t lastMoveTick;   /**< Low 16 bits of millis() at the last movement */
 };
 
 /**
@@ -46,11 +49,13 @@ struct RainDrop {
  * impacts the ground, including position and brightness fade.
  */
 struct GroundFlash {
-  int positionX;           /**< X coordinate of the flash effect */
-  int brightnessIntensity; /**< Current brightness intensity (0-15) */
-  int initialIntensity;    /**< Initial brightness intensity for proper fading */
-  unsigned long flashStartTime; /**< Timestamp when the flash started */
-  bool isActive;           /**< Whether this flash is currently active */
+  uint8_t positionX;           /**< X coordinate of the flash effect */
+  union {
+    uint8_t brightnessIntensity; /**< Current brightness intensity (0-15, while active) */
+    uint8_t nextFree;            /**< Next free slot in the free-list (while inactive) */
+  };
+  uint8_t initialIntensity;    /**< Initial brightness intensity for proper fading */
+  uint16_t flashStartTick;     /**< Low 16 bits of millis() when the flash started */
 };
 
 // ============================================================================
@@ -67,9 +72,14 @@ struct GroundFlash {
  * 
  * Features:
  * - Multiple simultaneous raindrops with random speeds
- * - Ground impact flash effects
+ * - Ground impact flash effects, fading through the panel's grey levels
+ *   when Max72xxPanel greyscale is on
  * - Configurable spawn rates and fall speeds
  * - Optimized rendering to reduce screen clearing
+ * - Change detection and an optional frame-rate cap: the display is only
+ *   redrawn and written when something visibly moved
+ * - Fixed particle pools with an active bitmask and a free-list, so spawning
+ *   is O(1) and updates and rendering only visit live particles
  * 
  * @note This class is designed to be used when GPS signal is lost or time is not acquired
  */
@@ -82,8 +92,9 @@ public:
   /**
    * @brief Constructor for RainEffect
    * @param matrix Reference to the LED matrix display object
+   * @param maxFps Maximum frames written to the display per second (0 = no cap)
    */
-  RainEffect(Max72xxPanel& matrix);
+  RainEffect(Max72xxPanel& matrix, uint8_t maxFps = 0);
   
   // ========================================================================
   // PUBLIC METHODS
@@ -107,21 +118,30 @@ public:
    * It handles spawning new raindrops, updating falling raindrops, and
    * managing ground flash effects.
    * 
+   * @return True if the picture changed since the last rendered frame
    * @note Call this method every loop iteration for smooth animation
    */
-  void update();
+  bool update();
   
   /**
    * @brief Render the rain effect to the LED matrix
    * 
    * This method draws all active raindrops and ground flashes to the
-   * LED matrix display. It includes optimizations to only clear and
-   * redraw when necessary.
+   * LED matrix display. The display is only redrawn and written when
+   * update() reported a change, and no sooner than the frame interval
+   * after the previous frame; a deferred change is drawn by a later call.
    * 
    * @note Call this method after update() to display the current frame
    */
   void render();
   
+  /**
+   * @brief Redraw the whole effect on the next render(), ignoring the frame cap
+   * 
+   * Used when another view has drawn over the display.
+   */
+  void invalidate();
+  
   /**
    * @brief Check if the rain effect is initialized
    * @return True if initialized, false otherwise
@@ -133,12 +153,21 @@ private:
   // CONSTANTS
   // ========================================================================
   
-  /** Maximum number of simultaneous raindrops */
+  /** Maximum number of simultaneous raindrops (at most 16, see ParticleMask) */
   static const int MAX_RAINDROPS = 8;
   
-  /** Maximum number of simultaneous ground flashes */
+  /** Maximum number of simultaneous ground flashes (at most 16, see ParticleMask) */
   static const int MAX_GROUND_FLASHES = 6;
   
+  /** Flash intensity above which the left/right spread is drawn */
+  static const uint8_t FLASH_SPREAD_INTENSITY = 8;
+  
+  /** Flash intensity above which the upward splash is drawn */
+  static const uint8_t FLASH_SPLASH_INTENSITY = 4;
+  
+  /** Free-list terminator */
+  static const uint8_t NO_FREE_SLOT = 0xFF;
+  
   /** Time interval between spawning new raindrops (milliseconds) */
   static const int RAIN_SPAWN_INTERVAL_MS = 250;
   
@@ -158,12 +187,39 @@ private:
   /** Reference to the LED matrix display object */
   Max72xxPanel& ledMatrix;
   
+  /** One bit per pool slot, set while the slot is active */
+  typedef uint16_t ParticleMask;
+  
   /** Array of raindrop objects */
   RainDrop raindropArray[MAX_RAINDROPS];
   
   /** Array of ground flash objects */
   GroundFlash groundFlashArray[MAX_GROUND_FLASHES];
   
+  /** Active raindrop slots */
+  ParticleMask activeRaindrops;
+  
+  /** Active ground flash slots */
+  ParticleMask activeGroundFlashes;
+  
+  /** First free raindrop slot (NO_FREE_SLOT if the pool is full) */
+  uint8_t freeRaindropHead;
+  
+  /** First free ground flash slot (NO_FREE_SLOT if the pool is full) */
+  uint8_t freeGroundFlashHead;
+  
+  /** Minimum time between rendered frames (milliseconds, 0 = no cap) */
+  uint16_t frameIntervalMs;
+  
+  /** Timestamp of the last frame written to the display */
+  unsigned long lastFrameTime;
+  
+  /** Set when the picture changed since the last rendered frame */
+  bool frameChanged;
+  
+  /** Set by invalidate(): render the next frame without waiting for the cap */
+  bool forceFrame;
+  
   /** Timestamp of the last raindrop spawn */
   unsigned long lastRaindropSpawnTime;
   
@@ -182,27 +238,56 @@ private:
    */
   void spawnNewRaindrop();
   
+  /**
+   * @brief Deactivate a raindrop and return its slot to the free-list
+   * @param raindropIndex Slot to release
+   */
+  void releaseRaindrop(uint8_t raindropIndex);
+  
+  /**
+   * @brief Deactivate a ground flash and return its slot to the free-list
+   * @param flashIndex Slot to release
+   */
+  void releaseGroundFlash(uint8_t flashIndex);
+  
   /**
    * @brief Update all falling raindrops
    * 
    * This method moves all active raindrops down the display and handles
    * ground impact when they reach the bottom.
+   * 
+   * @return True if any raindrop moved
    */
-  void updateFallingRaindrops();
+  bool updateFallingRaindrops();
   
   /**
    * @brief Create a ground impact flash at the specified position
    * @param xPosition X coordinate where the raindrop hit the ground
    */
-  void createGroundImpactFlash(int xPosition);
+  void createGroundImpactFlash(uint8_t xPosition);
   
   /**
    * @brief Update all ground flash effects
    * 
    * This method updates the brightness of all active ground flashes
    * and removes them when their duration expires.
+   * 
+   * @return True if any flash changed shape, grey level or expired
+   */
+  bool updateGroundImpactFlashes();
+  
+  /**
+   * @brief Summarize how a ground flash is drawn at an intensity
+   * 
+   * Two flashes with the same appearance render identically, so a fade only
+   * counts as a visible change when the appearance changes.
+   * 
+   * @param intensity Flash brightness intensity
+   * @return Shape (0 = impact point only, 1 = with upward splash, 2 = with
+   *         splash and spread) in bits 0-1, grey level in bits 2-3 when the
+   *         panel is in greyscale mode
    */
-  void updateGroundImpactFlashes();
+  uint8_t flashAppearance(uint8_t intensity) const;
 };
 
 #endif // RAIN_EFFECT_H
@@ -0,0 +1,174 @@
+/**
+ * @file SettingsStore.cpp
+ * @brief Implementation of the SettingsStore class for EEPROM persistence
+ *
+ * This file contains the implementation of the SettingsStore class, which
+ * scans the EEPROM journal for the newest record and writes new records
+ * byte by byte without blocking.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "SettingsStore.h"
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+#include <stddef.h>
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for SettingsStore
+ * @param baseAddress First EEPROM address of the journal
+ * @param length Journal size in bytes (rounded down to whole records)
+ */
+SettingsStore::SettingsStore(uint16_t baseAddress, uint16_t length)
+  : base(baseAddress), slotCount(length / sizeof(SettingsRecord)), slot(0),
+    writeOffset(sizeof(SettingsRecord)), commitRequested(false) {
+  static_assert(sizeof(SettingsRecord) < 0xFF, "writeOffset must hold the record size");
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Load the newest valid record, or defaults if there is none
+ * @param defaultBrightness Brightness used without a record
+ * @param default24Hour Time format used without a record
+ * @param defaultTimeZone Time zone index used without a record
+ *
+ * Reads every slot once (~1 KB of EEPROM reads, well under a millisecond).
+ * Without a record the last slot is treated as the newest, so the first
+ * record goes to slot 0.
+ */
+void SettingsStore::begin(uint8_t defaultBrightness, bool default24Hour, uint8_t defaultTimeZone) {
+  bool found = false;
+  slot = slotCount - 1;
+
+  for (uint8_t i = 0; i < slotCount; i++) {
+    SettingsRecord record;
+    EEPROM.get(base + i * sizeof(SettingsRecord), record);
+    if (record.version != RECORD_VERSION || record.crc != recordCrc(record)) continue;
+
+    // Sequence numbers wrap; newer means ahead by less than half the range
+    if (!found || (int16_t)(record.sequence - stored.sequence) > 0) {
+      stored = record;
+      slot = i;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    memset(&stored, 0, sizeof(stored));
+    stored.version = RECORD_VERSION;
+    stored.flags = default24Hour ? SETTINGS_FLAG_24H : 0;
+    stored.brightness = defaultBrightness;
+    stored.timeZone = defaultTimeZone;
+  }
+  current = stored;
+}
+
+/**
+ * @brief Continue writing the pending record
+ * @return True if a byte write was started, false if idle or the EEPROM
+ *         is still busy with the previous byte
+ *
+ * A new record is started only after the previous one is complete, so
+ * commits during a write are batched into the next record.
+ */
+bool SettingsStore::service() {
+  if (!isBusy()) {
+    if (!commitRequested) return false;
+    commitRequested = false;
+    if (!hasChanges()) return false;
+
+    current.version = RECORD_VERSION;
+    current.sequence = stored.sequence + 1;
+    current.crc = recordCrc(current);
+    stored = current;
+    slot = (slot + 1) % slotCount;
+    writeOffset = 0;
+  }
+
+  if (!eeprom_is_ready()) return false;
+
+  // Skip bytes that already hold the right value; start at most one write
+  const uint8_t* bytes = (const uint8_t*)&stored;
+  uint16_t address = base + slot * sizeof(SettingsRecord);
+  while (writeOffset < sizeof(SettingsRecord)) {
+    uint8_t offset = writeOffset++;
+    if (EEPROM.read(address + offset) != bytes[offset]) {
+      EEPROM.write(address + offset, bytes[offset]);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Set the time format
+ * @param enabled True for the 24-hour format
+ */
+void SettingsStore::set24Hour(bool enabled) {
+  if (enabled) {
+    current.flags |= SETTINGS_FLAG_24H;
+  } else {
+    current.flags &= ~SETTINGS_FLAG_24H;
+  }
+}
+
+/**
+ * @brief Store a position if it moved by more than a tolerance
+ * @param latE7 Latitude, degrees × 10^7
+ * @param lonE7 Longitude, degrees × 10^7
+ * @param toleranceE7 Smaller changes of both coordinates are ignored
+ */
+void SettingsStore::setPosition(int32_t latE7, int32_t lonE7, int32_t toleranceE7) {
+  if (hasPosition() &&
+      labs(latE7 - current.latitudeE7) <= toleranceE7 &&
+      labs(lonE7 - current.longitudeE7) <= toleranceE7) {
+    return;
+  }
+  current.latitudeE7 = latE7;
+  current.longitudeE7 = lonE7;
+  current.flags |= SETTINGS_FLAG_POSITION;
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Check if the current values differ from the stored record
+ * @return True if a new record is needed
+ */
+bool SettingsStore::hasChanges() const {
+  return current.flags != stored.flags ||
+         current.brightness != stored.brightness ||
+         current.powerCycles != stored.powerCycles ||
+         current.timeZone != stored.timeZone ||
+         current.latitudeE7 != stored.latitudeE7 ||
+         current.longitudeE7 != stored.longitudeE7;
+}
+
+/**
+ * @brief CRC-8 over a record, excluding the CRC byte
+ * @param record Record to check
+ * @return CRC-8 (polynomial 0x07)
+ */
+uint8_t SettingsStore::recordCrc(const SettingsRecord& record) {
+  const uint8_t* bytes = (const uint8_t*)&record;
+  uint8_t crc = 0;
+  for (uint8_t i = 0; i < offsetof(SettingsRecord, crc); i++) {
+    crc ^= bytes[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+  }
+  return crc;
+}
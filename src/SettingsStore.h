@@ -0,0 +1,244 @@
+/**
+ * @file SettingsStore.h
+ * @brief Wear-levelled settings journal in EEPROM
+ *
+ * This file contains the SettingsStore class that keeps the persistent
+ * settings (time format, time zone, brightness, power cycle count and last
+ * known position) in one versioned record, written round-robin across the EEPROM.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * @struct SettingsRecord
+ * @brief One journal entry as stored in EEPROM
+ *
+ * The sequence number identifies the newest record; the CRC covers all
+ * preceding bytes, so a record torn by a power loss is ignored and the
+ * previous one is used instead.
+ */
+struct SettingsRecord {
+  uint8_t version;       /**< Record layout version (SettingsStore::RECORD_VERSION) */
+  uint16_t sequence;     /**< Incremented with every record written */
+  uint8_t flags;         /**< SETTINGS_FLAG_* bits */
+  uint8_t brightness;    /**< Last display intensity (0-15) */
+  uint8_t powerCycles;   /**< Rapid power cycle counter for the format toggle */
+  uint8_t timeZone;      /**< Selected TimeZone table index */
+  int32_t latitudeE7;    /**< Last known latitude, degrees × 10^7 (valid with SETTINGS_FLAG_POSITION) */
+  int32_t longitudeE7;   /**< Last known longitude, degrees × 10^7 (valid with SETTINGS_FLAG_POSITION) */
+  uint8_t crc;           /**< CRC-8 of the bytes above */
+};
+
+/** Record flag: 24-hour time format */
+#define SETTINGS_FLAG_24H       0x01
+
+/** Record flag: latitudeE7/longitudeE7 hold a position */
+#define SETTINGS_FLAG_POSITION  0x02
+
+// ============================================================================
+// SETTINGS STORE CLASS
+// ============================================================================
+
+/**
+ * @class SettingsStore
+ * @brief Batched, wear-levelled persistence for the clock settings
+ *
+ * The EEPROM area is split into record-sized slots. Each commit writes the
+ * whole record to the slot after the newest one, so every slot wears at the
+ * same rate; on begin() the valid record with the highest sequence number
+ * is loaded.
+ *
+ * Features:
+ * - Setters only change the RAM copy; commit() batches them into one record
+ * - commit() without changes writes nothing
+ * - Bytes already holding the right value are not rewritten (EEPROM.update)
+ * - Non-blocking: service() starts at most one byte write per EEPROM write
+ *   time (~3.3 ms) and returns immediately while the EEPROM is busy
+ * - Falls back to the previous record when the newest one is torn
+ */
+class SettingsStore {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for SettingsStore
+   * @param baseAddress First EEPROM address of the journal
+   * @param length Journal size in bytes (rounded down to whole records)
+   */
+  SettingsStore(uint16_t baseAddress, uint16_t length);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Load the newest valid record, or defaults if there is none
+   * @param defaultBrightness Brightness used without a record
+   * @param default24Hour Time format used without a record
+   * @param defaultTimeZone Time zone index used without a record
+   */
+  void begin(uint8_t defaultBrightness, bool default24Hour, uint8_t defaultTimeZone);
+
+  /**
+   * @brief Request the current values to be written as a new record
+   *
+   * Returns immediately; the record is written by service(). Nothing is
+   * written if no value changed since the last record.
+   */
+  void commit() { commitRequested = true; }
+
+  /**
+   * @brief Continue writing the pending record
+   * @return True if a byte write was started, false if idle or the EEPROM
+   *         is still busy with the previous byte
+   * @note Call often (e.g. every scheduler pass); never blocks
+   */
+  bool service();
+
+  /**
+   * @brief Check if a record is still being written
+   * @return True while the journal write is in progress
+   */
+  bool isBusy() const { return writeOffset < sizeof(SettingsRecord); }
+
+  /**
+   * @brief Get the time format
+   * @return True for the 24-hour format
+   */
+  bool is24Hour() const { return current.flags & SETTINGS_FLAG_24H; }
+
+  /**
+   * @brief Set the time format
+   * @param enabled True for the 24-hour format
+   */
+  void set24Hour(bool enabled);
+
+  /**
+   * @brief Get the last display intensity
+   * @return Intensity level (0-15)
+   */
+  uint8_t brightness() const { return current.brightness; }
+
+  /**
+   * @brief Set the display intensity
+   * @param level Intensity level (0-15)
+   */
+  void setBrightness(uint8_t level) { current.brightness = level; }
+
+  /**
+   * @brief Get the rapid power cycle counter
+   * @return Number of counted power cycles
+   */
+  uint8_t powerCycles() const { return current.powerCycles; }
+
+  /**
+   * @brief Set the rapid power cycle counter
+   * @param count Number of counted power cycles
+   */
+  void setPowerCycles(uint8_t count) { current.powerCycles = count; }
+
+  /**
+   * @brief Get the selected time zone
+   * @return TimeZone table index
+   */
+  uint8_t timeZone() const { return current.timeZone; }
+
+  /**
+   * @brief Set the time zone
+   * @param index TimeZone table index
+   */
+  void setTimeZone(uint8_t index) { current.timeZone = index; }
+
+  /**
+   * @brief Check if a position has been stored
+   * @return True if latitudeE7() and longitudeE7() are valid
+   */
+  bool hasPosition() const { return current.flags & SETTINGS_FLAG_POSITION; }
+
+  /**
+   * @brief Get the last known latitude
+   * @return Latitude, degrees × 10^7
+   */
+  int32_t latitudeE7() const { return current.latitudeE7; }
+
+  /**
+   * @brief Get the last known longitude
+   * @return Longitude, degrees × 10^7
+   */
+  int32_t longitudeE7() const { return current.longitudeE7; }
+
+  /**
+   * @brief Store a position if it moved by more than a tolerance
+   * @param latE7 Latitude, degrees × 10^7
+   * @param lonE7 Longitude, degrees × 10^7
+   * @param toleranceE7 Smaller changes of both coordinates are ignored, so
+   *        GPS noise does not cause a record per commit
+   */
+  void setPosition(int32_t latE7, int32_t lonE7, int32_t toleranceE7);
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Record layout version; records of other versions are ignored */
+  static const uint8_t RECORD_VERSION = 2;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** First EEPROM address of the journal */
+  uint16_t base;
+
+  /** Number of record slots */
+  uint8_t slotCount;
+
+  /** Slot of the newest (or currently written) record */
+  uint8_t slot;
+
+  /** Next byte of the pending record to write (sizeof(SettingsRecord) = idle) */
+  uint8_t writeOffset;
+
+  /** commit() was called since the last record was started */
+  bool commitRequested;
+
+  /** Current values, changed by the setters */
+  SettingsRecord current;
+
+  /** Newest record in EEPROM, or the one being written */
+  SettingsRecord stored;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Check if the current values differ from the stored record
+   * @return True if a new record is needed
+   */
+  bool hasChanges() const;
+
+  /**
+   * @brief CRC-8 over a record, excluding the CRC byte
+   * @param record Record to check
+   * @return CRC-8 (polynomial 0x07)
+   */
+  static uint8_t recordCrc(const SettingsRecord& record);
+};
+
+#endif // SETTINGS_STORE_H
@@ -0,0 +1,200 @@
+/**
+ * @file SolarSchedule.cpp
+ * @brief Implementation of the SolarSchedule class for sunrise/sunset brightness
+ *
+ * This file contains the implementation of the SolarSchedule class, including
+ * the fixed-point sine table and the sunrise/sunset approximation.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "SolarSchedule.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** sin(i * 90 / 64 degrees) * 2^14 for i = 0..64 */
+static const int16_t SINE_TABLE[65] PROGMEM = {
+  0, 402, 804, 1205, 1606, 2006, 2404, 2801,
+  3196, 3590, 3981, 4370, 4756, 5139, 5520, 5897,
+  6270, 6639, 7005, 7366, 7723, 8076, 8423, 8765,
+  9102, 9434, 9760, 10080, 10394, 10702, 11003, 11297,
+  11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+  13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+  15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+  16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+  16384
+};
+
+/** One degree of latitude x 10^7 per binary angle unit (3.6e9 / 65536) */
+static const int32_t E7_PER_ANGLE_UNIT = 54932L;
+
+/** Maximum solar declination, 23.44 degrees, in binary angle units */
+static const int32_t MAX_DECLINATION = 4267L;
+
+/** sin(-0.833 degrees) * 2^14: sun centre at sunrise and sunset */
+static const int32_t SIN_SUNRISE_ALTITUDE = -238L;
+
+/** Minutes in a day */
+static const int16_t MINUTES_PER_DAY = 1440;
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for SolarSchedule
+ *
+ * Starts without a schedule; isValid() is false until the first update().
+ */
+SolarSchedule::SolarSchedule()
+  : computedDay(0), sunrise(0), sunset(0), polarState(0) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Compute sunrise and sunset if the day changed
+ * @param latitudeE7 Latitude in degrees x 10^7
+ * @param longitudeE7 Longitude in degrees x 10^7 (east positive)
+ * @param dayOfYear Day of the year in UTC (1-366)
+ * @return True if the schedule was recomputed
+ */
+bool SolarSchedule::update(int32_t latitudeE7, int32_t longitudeE7, uint16_t dayOfYear) {
+  if (dayOfYear == computedDay) return false;
+  computedDay = dayOfYear;
+
+  // Solar declination: -23.44 degrees * cos(360 / 365 * (day + 10))
+  uint16_t yearAngle = (uint32_t)(dayOfYear + 10) * 65536UL / 365;
+  int16_t declination = -(MAX_DECLINATION * cos16(yearAngle)) >> 14;
+
+  // Equation of time in hundredths of a minute, B = 360 / 364 * (day - 81):
+  // 9.87 * sin(2B) - 7.53 * cos(B) - 1.5 * sin(B)
+  uint16_t b = ((int32_t)dayOfYear - 81) * 65536L / 364;
+  int32_t equationOfTime = (987L * sin16(2 * b) - 753L * cos16(b) - 150L * sin16(b)) / 16384;
+
+  // Sunrise hour angle: cos(H) = (sin(h0) - sin(lat) sin(decl)) / (cos(lat) cos(decl))
+  uint16_t latitude = (uint16_t)(int16_t)(latitudeE7 / E7_PER_ANGLE_UNIT);
+  int32_t sinLatSinDecl = ((int32_t)sin16(latitude) * sin16(declination)) >> 14;
+  int32_t cosLatCosDecl = ((int32_t)cos16(latitude) * cos16(declination)) >> 14;
+  int32_t numerator = SIN_SUNRISE_ALTITUDE - sinLatSinDecl;
+
+  if (numerator >= cosLatCosDecl) {
+    polarState = SUN_ALWAYS_DOWN;
+    return true;
+  }
+  if (numerator <= -cosLatCosDecl) {
+    polarState = SUN_ALWAYS_UP;
+    return true;
+  }
+  polarState = 0;
+
+  int16_t cosHourAngle = numerator * 16384 / cosLatCosDecl;
+  // Hour angle to minutes: 4 minutes per degree = 1440 minutes per turn
+  int16_t halfDay = (int32_t)acos16(cosHourAngle) * MINUTES_PER_DAY / 65536L;
+
+  // Solar noon in UTC: 4 minutes per degree of longitude and the equation of time
+  int16_t longitudeMinutes = (longitudeE7 / 10000L) * 4 / 1000;
+  int16_t solarNoon = 720 - longitudeMinutes - (equationOfTime + 50) / 100;
+
+  sunrise = wrapMinutes(solarNoon - halfDay);
+  sunset = wrapMinutes(solarNoon + halfDay);
+  return true;
+}
+
+/**
+ * @brief Brightness for a time of day
+ * @param utcMinutes Current UTC minute of the day (0-1439)
+ * @param nightLevel Intensity at night
+ * @param dayLevel Intensity during the day
+ * @param rampMinutes Duration of the dawn and dusk ramps
+ * @return Intensity between nightLevel and dayLevel
+ *
+ * Works wherever midnight UTC falls relative to sunrise and sunset.
+ */
+uint8_t SolarSchedule::brightness(uint16_t utcMinutes, uint8_t nightLevel, uint8_t dayLevel, uint16_t rampMinutes) const {
+  if (polarState == SUN_ALWAYS_UP) return dayLevel;
+  if (polarState == SUN_ALWAYS_DOWN) return nightLevel;
+
+  // Depth into the day (positive: minutes to the nearer of sunrise and
+  // sunset) or into the night (negative); the ramps are centered on zero
+  int16_t sinceSunrise = wrapMinutes(utcMinutes - sunrise);
+  int16_t dayLength = wrapMinutes(sunset - sunrise);
+  int16_t depth;
+  if (sinceSunrise < dayLength) {
+    int16_t untilSunset = dayLength - sinceSunrise;
+    depth = sinceSunrise < untilSunset ? sinceSunrise : untilSunset;
+  } else {
+    int16_t sinceSunset = sinceSunrise - dayLength;
+    int16_t untilSunrise = MINUTES_PER_DAY - sinceSunrise;
+    depth = -(sinceSunset < untilSunrise ? sinceSunset : untilSunrise);
+  }
+
+  int16_t rampPosition = depth + (int16_t)(rampMinutes / 2);
+  if (rampPosition <= 0) return nightLevel;
+  if (rampPosition >= (int16_t)rampMinutes) return dayLevel;
+  return nightLevel + ((int16_t)(dayLevel - nightLevel) * rampPosition + (int16_t)rampMinutes / 2) / (int16_t)rampMinutes;
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Sine of a binary angle
+ * @param angle Angle (65536 = one turn)
+ * @return Sine scaled by 2^14
+ *
+ * Quarter-wave table lookup with linear interpolation.
+ */
+int16_t SolarSchedule::sin16(uint16_t angle) {
+  uint16_t offset = angle & 0x3FFF;
+  if (angle & 0x4000) offset = 0x4000 - offset;  // Second and fourth quarter mirror the first
+
+  uint8_t index = offset >> 8;
+  int16_t value = pgm_read_word(&SINE_TABLE[index]);
+  if (index < 64) {
+    int16_t next = pgm_read_word(&SINE_TABLE[index + 1]);
+    value += ((int32_t)(next - value) * (offset & 0xFF)) >> 8;
+  }
+
+  return (angle & 0x8000) ? -value : value;
+}
+
+/**
+ * @brief Inverse cosine
+ * @param value Cosine scaled by 2^14 (-16384 to 16384)
+ * @return Angle between 0 and half a turn (32768)
+ *
+ * Binary search, as the cosine falls steadily over half a turn.
+ */
+uint16_t SolarSchedule::acos16(int16_t value) {
+  uint16_t low = 0;
+  uint16_t high = 0x8000;
+  while (high - low > 1) {
+    uint16_t mid = (low + high) / 2;
+    if (cos16(mid) > value) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+/**
+ * @brief Wrap a minute count into 0-1439
+ * @param minutes Minutes, may be negative or past midnight
+ * @return Minute of the day
+ */
+uint16_t SolarSchedule::wrapMinutes(int16_t minutes) {
+  while (minutes < 0) minutes += MINUTES_PER_DAY;
+  while (minutes >= MINUTES_PER_DAY) minutes -= MINUTES_PER_DAY;
+  return minutes;
+}
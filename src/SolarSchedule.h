@@ -0,0 +1,165 @@
+/**
+ * @file SolarSchedule.h
+ * @brief Sunrise and sunset times from the GPS position for brightness control
+ *
+ * This file contains the SolarSchedule class that computes the daily sunrise
+ * and sunset times with integer trigonometry and maps the time of day to an
+ * LED matrix intensity with a ramp across dawn and dusk.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef SOLAR_SCHEDULE_H
+#define SOLAR_SCHEDULE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// SOLAR SCHEDULE CLASS
+// ============================================================================
+
+/**
+ * @class SolarSchedule
+ * @brief Daily sunrise/sunset cache and day/night brightness ramp
+ *
+ * Sunrise and sunset follow the usual approximation: solar declination and
+ * the equation of time from the day of the year, then the hour angle at
+ * which the sun is 0.833 degrees below the horizon (refraction and the
+ * solar disc). Angles are 16-bit binary angles (65536 = one turn) and
+ * trigonometry uses a quarter-wave sine table, so no floating point is
+ * needed. The result is within a few minutes, plenty for brightness.
+ *
+ * Features:
+ * - Computed once per day, cached until the day of the year changes
+ * - Polar day and polar night handled (always day or night level)
+ * - All times are UTC minutes of the day, so time zone and DST changes
+ *   don't affect the cache
+ *
+ * @note Without a computed schedule (no position yet) isValid() is false
+ */
+class SolarSchedule {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for SolarSchedule
+   */
+  SolarSchedule();
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Compute sunrise and sunset if the day changed
+   * @param latitudeE7 Latitude in degrees x 10^7
+   * @param longitudeE7 Longitude in degrees x 10^7 (east positive)
+   * @param dayOfYear Day of the year in UTC (1-366)
+   * @return True if the schedule was recomputed
+   */
+  bool update(int32_t latitudeE7, int32_t longitudeE7, uint16_t dayOfYear);
+
+  /**
+   * @brief Check if a schedule has been computed
+   * @return True after the first update()
+   */
+  bool isValid() const { return computedDay != 0; }
+
+  /**
+   * @brief Discard the cached schedule, so the next update() recomputes it
+   * @note Use when the position source changes within a day
+   */
+  void invalidate() { computedDay = 0; }
+
+  /**
+   * @brief Get the sunrise time
+   * @return Sunrise in UTC minutes of the day (0-1439)
+   */
+  uint16_t sunriseUtcMinutes() const { return sunrise; }
+
+  /**
+   * @brief Get the sunset time
+   * @return Sunset in UTC minutes of the day (0-1439)
+   */
+  uint16_t sunsetUtcMinutes() const { return sunset; }
+
+  /**
+   * @brief Brightness for a time of day
+   *
+   * Day level between sunrise and sunset, night level otherwise, with a
+   * linear ramp of rampMinutes centered on sunrise and on sunset.
+   *
+   * @param utcMinutes Current UTC minute of the day (0-1439)
+   * @param nightLevel Intensity at night
+   * @param dayLevel Intensity during the day
+   * @param rampMinutes Duration of the dawn and dusk ramps
+   * @return Intensity between nightLevel and dayLevel
+   */
+  uint8_t brightness(uint16_t utcMinutes, uint8_t nightLevel, uint8_t dayLevel, uint16_t rampMinutes) const;
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Sun above the horizon all day */
+  static const uint8_t SUN_ALWAYS_UP = 1;
+
+  /** Sun below the horizon all day */
+  static const uint8_t SUN_ALWAYS_DOWN = 2;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Day of the year of the cached schedule (0 = none) */
+  uint16_t computedDay;
+
+  /** Sunrise in UTC minutes of the day */
+  uint16_t sunrise;
+
+  /** Sunset in UTC minutes of the day */
+  uint16_t sunset;
+
+  /** 0 for a normal day, or SUN_ALWAYS_UP / SUN_ALWAYS_DOWN */
+  uint8_t polarState;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Sine of a binary angle
+   * @param angle Angle (65536 = one turn)
+   * @return Sine scaled by 2^14
+   */
+  static int16_t sin16(uint16_t angle);
+
+  /**
+   * @brief Cosine of a binary angle
+   * @param angle Angle (65536 = one turn)
+   * @return Cosine scaled by 2^14
+   */
+  static int16_t cos16(uint16_t angle) { return sin16(angle + 0x4000); }
+
+  /**
+   * @brief Inverse cosine
+   * @param value Cosine scaled by 2^14 (-16384 to 16384)
+   * @return Angle between 0 and half a turn (32768)
+   */
+  static uint16_t acos16(int16_t value);
+
+  /**
+   * @brief Wrap a minute count into 0-1439
+   * @param minutes Minutes, may be negative or past midnight
+   * @return Minute of the day
+   */
+  static uint16_t wrapMinutes(int16_t minutes);
+};
+
+#endif // SOLAR_SCHEDULE_H
@@ -0,0 +1,125 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief Implementation of the TaskScheduler class for cooperative scheduling
+ *
+ * This file contains the implementation of the TaskScheduler class, which
+ * dispatches the task table and records per-task runtime statistics.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "TaskScheduler.h"
+#include <avr/sleep.h>
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for TaskScheduler
+ * @param tasks Task table (must stay valid for the lifetime of the scheduler)
+ * @param count Number of entries in the table
+ */
+TaskScheduler::TaskScheduler(SchedulerTask* tasks, uint8_t count)
+  : tasks(tasks), taskCount(count) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Start the periodic tasks; the first run is one period from now
+ */
+void TaskScheduler::begin() {
+  unsigned long currentTime = millis();
+  for (uint8_t i = 0; i < taskCount; i++) {
+    tasks[i].nextRunTime = currentTime + tasks[i].periodMs;
+  }
+}
+
+/**
+ * @brief Run every task that is due, in table order
+ *
+ * A task that returns false keeps its due time and is offered again on the
+ * next dispatch; only runs that did work are measured.
+ */
+void TaskScheduler::dispatch() {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    SchedulerTask& task = tasks[i];
+
+    unsigned long currentTime = millis();
+    if (task.periodMs != 0 && (long)(currentTime - task.nextRunTime) < 0) continue;
+
+    unsigned long startMicros = micros();
+    if (!task.callback()) continue;
+    unsigned long runMicros = micros() - startMicros;
+
+    if (runMicros > task.worstMicros) task.worstMicros = runMicros;
+    if (runMicros > task.deadlineMicros && task.deadlineMisses < 0xFFFF) task.deadlineMisses++;
+
+    if (task.periodMs != 0) {
+      task.nextRunTime += task.periodMs;
+      // More than a period behind: restart the grid instead of catching up
+      if ((long)(currentTime - task.nextRunTime) >= 0) {
+        task.nextRunTime = currentTime + task.periodMs;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Sleep in SLEEP_MODE_IDLE until the next interrupt
+ *
+ * Only the CPU clock stops; the interrupt that wakes it runs first, then
+ * execution continues here.
+ */
+void TaskScheduler::idle() {
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_enable();
+  sleep_cpu();
+  sleep_disable();
+}
+
+/**
+ * @brief Print one line per task: name, worst-case runtime and deadline misses
+ * @param output Destination, e.g. Serial
+ */
+void TaskScheduler::printStats(Print& output) const {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    const SchedulerTask& task = tasks[i];
+    output.print(F("TASK "));
+    output.print(task.name);
+    output.print(F(" - Worst: "));
+    output.print(task.worstMicros);
+    output.print(F("us, Deadline: "));
+    output.print(task.deadlineMicros);
+    output.print(F("us, Misses: "));
+    output.println(task.deadlineMisses);
+  }
+}
+
+/**
+ * @brief Get the deadline misses of all tasks together
+ * @return Sum of the per-task misses (saturates at 0xFFFF)
+ */
+uint16_t TaskScheduler::totalDeadlineMisses() const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < taskCount; i++) {
+    total += tasks[i].deadlineMisses;
+  }
+  return total > 0xFFFF ? 0xFFFF : total;
+}
+
+/**
+ * @brief Clear the measured worst-case runtimes and deadline misses
+ */
+void TaskScheduler::resetStats() {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    tasks[i].worstMicros = 0;
+    tasks[i].deadlineMisses = 0;
+  }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file TaskScheduler.h
+ * @brief Static cooperative task scheduler for the main loop
+ *
+ * This file contains the TaskScheduler class that runs a fixed table of
+ * periodic tasks from loop() and measures how long each one takes, so the
+ * task using up the frame budget can be found directly.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * @brief Task function
+ * @return True if the task did its work, false to stay due and be retried
+ *         on the next dispatch (e.g. the display is busy)
+ */
+typedef bool (*TaskCallback)();
+
+/**
+ * @struct SchedulerTask
+ * @brief One entry of the task table: configuration followed by runtime state
+ *
+ * Tables are initialized with the first four fields only; the remaining
+ * fields start at zero.
+ */
+struct SchedulerTask {
+  const char* name;             /**< Short name for the statistics output */
+  TaskCallback callback;        /**< Function to run */
+  unsigned long periodMs;       /**< Run interval (0 = every dispatch) */
+  unsigned long deadlineMicros; /**< Runtime budget; longer runs count as deadline misses */
+
+  unsigned long nextRunTime;    /**< millis() at which the task is due next */
+  unsigned long worstMicros;    /**< Longest measured runtime */
+  uint16_t deadlineMisses;      /**< Runs that took longer than deadlineMicros */
+};
+
+// ============================================================================
+// TASK SCHEDULER CLASS
+// ============================================================================
+
+/**
+ * @class TaskScheduler
+ * @brief Runs a fixed task table cooperatively, one pass per loop() iteration
+ *
+ * Tasks run in table order. A periodic task becomes due every periodMs on a
+ * fixed time grid (no drift from late runs); if it falls more than a period
+ * behind, the grid restarts from the current time instead of running the
+ * task several times in a row.
+ *
+ * Features:
+ * - Caller-provided static table, no dynamic memory
+ * - Worst-case runtime and deadline misses per task
+ * - Tasks can decline to run and stay due
+ * - Idle sleep between passes (SLEEP_MODE_IDLE), woken by any interrupt
+ *
+ * @note Tasks must return quickly; a blocking task delays every other task
+ */
+class TaskScheduler {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for TaskScheduler
+   * @param tasks Task table (must stay valid for the lifetime of the scheduler)
+   * @param count Number of entries in the table
+   */
+  TaskScheduler(SchedulerTask* tasks, uint8_t count);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Start the periodic tasks; the first run is one period from now
+   */
+  void begin();
+
+  /**
+   * @brief Run every task that is due, in table order
+   * @note Call once per loop() iteration
+   */
+  void dispatch();
+
+  /**
+   * @brief Sleep in SLEEP_MODE_IDLE until the next interrupt
+   *
+   * Timers, UART and external interrupts keep running. The Timer0 overflow
+   * behind millis() wakes the CPU at least every 1.024 ms, so periodic tasks
+   * still run on time; UART RX, timer and PPS interrupts wake it earlier.
+   *
+   * @note Call after dispatch() when there is no other work pending
+   */
+  void idle();
+
+  /**
+   * @brief Print one line per task: name, worst-case runtime and deadline misses
+   * @param output Destination, e.g. Serial
+   */
+  void printStats(Print& output) const;
+
+  /**
+   * @brief Clear the measured worst-case runtimes and deadline misses
+   */
+  void resetStats();
+
+  /**
+   * @brief Get the deadline misses of all tasks together
+   * @return Sum of the per-task misses (saturates at 0xFFFF)
+   */
+  uint16_t totalDeadlineMisses() const;
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Task table */
+  SchedulerTask* tasks;
+
+  /** Number of tasks in the table */
+  uint8_t taskCount;
+};
+
+#endif // TASK_SCHEDULER_H
@@ -0,0 +1,129 @@
+/**
+ * @file Telemetry.cpp
+ * @brief Implementation of the Telemetry class for binary serial telemetry
+ *
+ * This file contains the implementation of the Telemetry class, which
+ * assembles packets and writes them with COBS framing.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "Telemetry.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for Telemetry
+ * @param output Destination, e.g. Serial
+ */
+Telemetry::Telemetry(Print& output)
+  : output(output), length(0), sequence(0) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Start a packet
+ * @param type Packet type (TELEMETRY_*)
+ */
+void Telemetry::begin(uint8_t type) {
+  packet[0] = type;
+  packet[1] = sequence++;
+  length = 2;
+}
+
+/**
+ * @brief Append an 8-bit field
+ * @param value Field value
+ *
+ * Fields beyond MAX_PACKET - 1 bytes are dropped (the CRC still fits).
+ */
+void Telemetry::add8(uint8_t value) {
+  if (length < MAX_PACKET - 1) packet[length++] = value;
+}
+
+/**
+ * @brief Append a 16-bit field, little-endian
+ * @param value Field value
+ */
+void Telemetry::add16(uint16_t value) {
+  add8(value);
+  add8(value >> 8);
+}
+
+/**
+ * @brief Append a 32-bit field, little-endian
+ * @param value Field value
+ */
+void Telemetry::add32(uint32_t value) {
+  add16(value);
+  add16(value >> 16);
+}
+
+/**
+ * @brief Finish the packet and write it as one COBS frame
+ *
+ * COBS replaces every 0x00 with the distance to the next one: each block
+ * of non-zero bytes is preceded by its length + 1, and the frame ends with
+ * the 0x00 delimiter. Packets are shorter than 254 bytes, so no block
+ * needs the 0xFF continuation code. Bytes the GPS receiver could act on
+ * are escaped on the way out.
+ */
+void Telemetry::send() {
+  packet[length] = packetCrc();
+  length++;
+
+  uint8_t blockStart = 0;
+  for (uint8_t i = 0; i <= length; i++) {
+    // The end of the packet acts as a final zero
+    if (i == length || packet[i] == 0) {
+      writeEscaped(i - blockStart + 1);
+      for (uint8_t j = blockStart; j < i; j++) {
+        writeEscaped(packet[j]);
+      }
+      blockStart = i + 1;
+    }
+  }
+  output.write((uint8_t)0);
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief CRC-8 over the packet built so far
+ * @return CRC-8 (polynomial 0x07)
+ */
+uint8_t Telemetry::packetCrc() const {
+  uint8_t crc = 0;
+  for (uint8_t i = 0; i < length; i++) {
+    crc ^= packet[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+/**
+ * @brief Write one encoded byte, escaping '$', 0xB5 and ESCAPE
+ * @param value Byte to write
+ *
+ * The escaped forms (0x04, 0x95, 0x5D) are none of the special bytes and
+ * never 0x00, so the COBS delimiter stays unique.
+ */
+void Telemetry::writeEscaped(uint8_t value) {
+  if (value == '$' || value == 0xB5 || value == ESCAPE) {
+    output.write(ESCAPE);
+    value ^= ESCAPE_XOR;
+  }
+  output.write(value);
+}
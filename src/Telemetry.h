@@ -0,0 +1,175 @@
+/**
+ * @file Telemetry.h
+ * @brief COBS-framed binary telemetry packets over serial
+ *
+ * This file contains the Telemetry class that builds small binary packets
+ * (time, fix state, coordinates, health counters) and sends them as COBS
+ * frames, as a compact replacement for the text debug output.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// PACKET TYPES
+// ============================================================================
+
+/*
+ * Packet layout before COBS encoding (multi-byte fields little-endian):
+ *
+ *   [type:u8] [sequence:u8] [payload...] [crc8:u8]
+ *
+ * The sequence number increments with every packet, so the host can count
+ * lost frames. The CRC-8 (polynomial 0x07) covers type, sequence and
+ * payload. Each frame ends with a 0x00 delimiter.
+ *
+ * After COBS encoding, '$' (0x24), 0xB5 and the escape byte 0x7D are sent
+ * as 0x7D followed by the byte XOR 0x20. The GPS module listens on the same
+ * TX line, and these are the first bytes of NMEA commands and the UBX sync
+ * sequence (0xB5 0x62), so no frame can look like a receiver command.
+ *
+ * Payloads:
+ *
+ * TELEMETRY_STATUS:   utc:u32 source:u8 flags:u8 offsetMinutes:i16
+ *                     readings:u8 brightness:u8 failedChecksums:u16
+ * TELEMETRY_POSITION: rawLatE7:i32 rawLonE7:i32 latE7:i32 lonE7:i32 altCm:i32
+ * TELEMETRY_HEALTH:   uptimeMs:u32 rxBytes:u32 rxDropped:u32
+ *                     rxOverflows:u16 rxHighWater:u8 deadlineMisses:u16
+ */
+
+/** Time and fix state (utc = 0 without a time) */
+#define TELEMETRY_STATUS    0x01
+
+/** Raw and filtered coordinates */
+#define TELEMETRY_POSITION  0x02
+
+/** GPS receive buffer and scheduler counters */
+#define TELEMETRY_HEALTH    0x03
+
+/** Status flags */
+#define TELEMETRY_FLAG_GPS_TIME   0x01  /**< GPS date and time valid */
+#define TELEMETRY_FLAG_LOCATION   0x02  /**< GPS location valid */
+#define TELEMETRY_FLAG_MOVING     0x04  /**< Filter in motion mode */
+#define TELEMETRY_FLAG_DST        0x08  /**< Daylight saving time in effect */
+#define TELEMETRY_FLAG_PPS_LOCKED 0x10  /**< Display locked to the PPS edge */
+
+// ============================================================================
+// TELEMETRY CLASS
+// ============================================================================
+
+/**
+ * @class Telemetry
+ * @brief Builds binary packets and writes them as COBS frames
+ *
+ * Usage: begin(type), add the payload fields, send(). Frames are small
+ * (MAX_PACKET + 2 bytes, more only for the rare escaped bytes) and fit the
+ * hardware serial transmit buffer, so sending does not block in normal
+ * operation.
+ *
+ * Features:
+ * - Consistent Overhead Byte Stuffing: 0x00 only appears as the delimiter,
+ *   so the host resynchronizes on the next frame after any garbage
+ * - Sequence number and CRC-8 per packet
+ * - Cannot be mistaken for NMEA or UBX input by the GPS receiver
+ * - No formatting: fields are copied as binary integers
+ */
+class Telemetry {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for Telemetry
+   * @param output Destination, e.g. Serial
+   */
+  Telemetry(Print& output);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Start a packet
+   * @param type Packet type (TELEMETRY_*)
+   */
+  void begin(uint8_t type);
+
+  /**
+   * @brief Append an 8-bit field
+   * @param value Field value
+   */
+  void add8(uint8_t value);
+
+  /**
+   * @brief Append a 16-bit field
+   * @param value Field value
+   */
+  void add16(uint16_t value);
+
+  /**
+   * @brief Append a 32-bit field
+   * @param value Field value
+   */
+  void add32(uint32_t value);
+
+  /**
+   * @brief Finish the packet and write it as one COBS frame
+   */
+  void send();
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Largest packet: type, sequence, payload and CRC */
+  static const uint8_t MAX_PACKET = 24;
+
+  /** Escape byte; the escaped byte follows XOR ESCAPE_XOR */
+  static const uint8_t ESCAPE = 0x7D;
+
+  /** Applied to escaped bytes */
+  static const uint8_t ESCAPE_XOR = 0x20;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Destination of the frames */
+  Print& output;
+
+  /** Packet being built */
+  uint8_t packet[MAX_PACKET];
+
+  /** Bytes in packet */
+  uint8_t length;
+
+  /** Sequence number of the next packet */
+  uint8_t sequence;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief CRC-8 over the packet built so far
+   * @return CRC-8 (polynomial 0x07)
+   */
+  uint8_t packetCrc() const;
+
+  /**
+   * @brief Write one encoded byte, escaping '$', 0xB5 and ESCAPE
+   * @param value Byte to write
+   */
+  void writeEscaped(uint8_t value);
+};
+
+#endif // TELEMETRY_H
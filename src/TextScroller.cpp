@@ -0,0 +1,185 @@
+/**
+ * @file TextScroller.cpp
+ * @brief Implementation of the TextScroller class for non-blocking text scrolling
+ *
+ * This file contains the implementation of the TextScroller class, which
+ * scrolls queued messages across the LED matrix one column per frame.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "TextScroller.h"
+#include "ColumnCanvas.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for TextScroller
+ * @param matrix Reference to the LED matrix display object
+ *
+ * Initializes the scroller with an empty message queue.
+ */
+TextScroller::TextScroller(Max72xxPanel& matrix)
+  : ledMatrix(matrix), headIndex(0), queuedMessages(0), scrollPositionX(0),
+    messageWidth(0), textWidth(0), glyphIndex(-1), fullRedraw(true), lastFrameTime(0),
+    completionCallback(nullptr) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Add a message to the end of the scroll queue
+ * @param message The text message to scroll (null-terminated string)
+ * @return True if the message was queued, false if the queue is full
+ *
+ * When the scroller was idle, the new message starts on the next update().
+ */
+bool TextScroller::enqueue(const char* message) {
+  if (queuedMessages >= MAX_QUEUED_MESSAGES) return false;
+
+  uint8_t tailIndex = (headIndex + queuedMessages) % MAX_QUEUED_MESSAGES;
+  strncpy(messageQueue[tailIndex], message, MAX_MESSAGE_LENGTH);
+  messageQueue[tailIndex][MAX_MESSAGE_LENGTH] = '\0';
+  flashMessages[tailIndex] = nullptr;
+  queuedMessages++;
+
+  // Start right away when the scroller was idle
+  if (queuedMessages == 1) {
+    beginMessage();
+    lastFrameTime = millis() - SCROLL_FRAME_INTERVAL_MS;
+  }
+  return true;
+}
+
+/**
+ * @brief Add a flash-resident message to the end of the scroll queue
+ * @param message The text message to scroll, e.g. F("Hello")
+ * @return True if the message was queued, false if the queue is full
+ *
+ * When the scroller was idle, the new message starts on the next update().
+ */
+bool TextScroller::enqueue(const __FlashStringHelper* message) {
+  if (queuedMessages >= MAX_QUEUED_MESSAGES) return false;
+
+  uint8_t tailIndex = (headIndex + queuedMessages) % MAX_QUEUED_MESSAGES;
+  flashMessages[tailIndex] = message;
+  queuedMessages++;
+
+  // Start right away when the scroller was idle
+  if (queuedMessages == 1) {
+    beginMessage();
+    lastFrameTime = millis() - SCROLL_FRAME_INTERVAL_MS;
+  }
+  return true;
+}
+
+/**
+ * @brief Advance the scroll by one column if the next frame is due
+ *
+ * The first frame of a message clears the display, with the message just
+ * past the right edge; later frames only shift the display left and append
+ * the message column entering at the right edge.
+ * Once the message and its trailing blank have left the display, the next
+ * queued message is started, or the completion callback is invoked if the
+ * queue is empty.
+ */
+void TextScroller::update() {
+  // Exit early if idle or frame not due yet
+  if (queuedMessages == 0) return;
+
+  unsigned long currentTime = millis();
+  if ((unsigned long)(currentTime - lastFrameTime) < SCROLL_FRAME_INTERVAL_MS) return;
+  lastFrameTime = currentTime;
+
+  int displayWidth = ledMatrix.width();
+
+  if (fullRedraw) {
+    // The message starts just past the right edge: nothing of it is visible yet
+    ledMatrix.fillScreen(LOW);
+    fullRedraw = false;
+  } else {
+    // The display already shows the previous frame: shift in one column
+    int entering = displayWidth - 1 - scrollPositionX;
+    ledMatrix.scrollLeft(entering >= 0 && entering < textWidth ? messageColumn(entering) : 0);
+  }
+  ledMatrix.write();
+
+  // Move one column left, finish the message once it has fully scrolled out
+  if (--scrollPositionX < -messageWidth) {
+    headIndex = (headIndex + 1) % MAX_QUEUED_MESSAGES;
+    queuedMessages--;
+
+    if (queuedMessages > 0) {
+      beginMessage();
+    } else if (completionCallback != nullptr) {
+      completionCallback();
+    }
+  }
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Prepare the message at the head of the queue for scrolling
+ *
+ * The message stays where it was queued, in RAM or in flash; its glyphs are
+ * drawn one at a time while it scrolls. The width includes one blank
+ * character after the text for readability, and is at least the display
+ * width so short messages still scroll fully.
+ */
+void TextScroller::beginMessage() {
+  size_t length;
+  const __FlashStringHelper* flashMessage = flashMessages[headIndex];
+  if (flashMessage != nullptr) {
+    // Anything past MAX_MESSAGE_LENGTH is cut, as for copied messages
+    length = strlen_P(reinterpret_cast<PGM_P>(flashMessage));
+    if (length > MAX_MESSAGE_LENGTH) length = MAX_MESSAGE_LENGTH;
+  } else {
+    length = strlen(messageQueue[headIndex]);
+  }
+
+  textWidth = length * CHAR_WIDTH_PX;
+  glyphIndex = -1;
+  messageWidth = textWidth + CHAR_WIDTH_PX;
+  if (messageWidth < ledMatrix.width()) {
+    messageWidth = ledMatrix.width();
+  }
+
+  scrollPositionX = ledMatrix.width();
+  fullRedraw = true;
+}
+
+/**
+ * @brief Get one column of the current message's text
+ * @param column Column from the start of the message (0 to textWidth - 1)
+ * @return Column pixels, bit 0 = top row
+ *
+ * Columns are asked for left to right, so each character's glyph is drawn
+ * once through Adafruit_GFX, when its first column enters the display, and
+ * its other columns come from glyphColumns.
+ */
+uint8_t TextScroller::messageColumn(int column) {
+  int8_t index = column / CHAR_WIDTH_PX;
+
+  if (index != glyphIndex) {
+    const __FlashStringHelper* flashMessage = flashMessages[headIndex];
+    char character = flashMessage != nullptr
+      ? pgm_read_byte(reinterpret_cast<PGM_P>(flashMessage) + index)
+      : messageQueue[headIndex][index];
+
+    // Opaque background: all CHAR_WIDTH_PX columns are written, spacing included
+    ColumnCanvas canvas(glyphColumns, CHAR_WIDTH_PX);
+    canvas.drawChar(0, 0, character, HIGH, LOW, 1);
+    glyphIndex = index;
+  }
+  return glyphColumns[column % CHAR_WIDTH_PX];
+}
@@ -0,0 +1,199 @@
+/**
+ * @file TextScroller.h
+ * @brief Non-blocking horizontal text scroller for LED matrix display
+ *
+ * This file contains the TextScroller class that scrolls queued text messages
+ * from right to left across the LED matrix. The scroller advances one column
+ * per frame from the main loop, so GPS data keeps being parsed while text is
+ * on the display.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef TEXT_SCROLLER_H
+#define TEXT_SCROLLER_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Max72xxPanel.h>
+
+// ============================================================================
+// TEXT SCROLLER CLASS
+// ============================================================================
+
+/**
+ * @class TextScroller
+ * @brief Cooperative marquee scroller with a small message queue
+ *
+ * Messages are copied into a fixed-size FIFO queue with enqueue() and played
+ * back to back by update(). Flash strings (F() / PROGMEM) are queued as
+ * pointers only and read straight from flash when the message starts. Each
+ * message scrolls in from the right edge and fully out on the left, followed
+ * by one blank character for readability.
+ * A completion callback is invoked once the queue runs empty, so the caller
+ * can restore its own view of the display.
+ *
+ * The first frame of a message clears the display; every following frame
+ * shifts the display one column left (Max72xxPanel::scrollLeft()) and
+ * appends the column entering at the right edge. That column comes from the
+ * glyph of the character entering the display, which is rendered into a one
+ * character buffer when its first column is due, so a message is never held
+ * as rendered columns.
+ *
+ * Features:
+ * - One column per frame, no blocking delays
+ * - One glyph drawn per character, just an in-place shift of the display
+ *   in the other frames
+ * - Up to MAX_QUEUED_MESSAGES messages played back to back
+ * - Completion callback when the last message has scrolled out
+ *
+ * @note While isActive() returns true the scroller owns the display
+ */
+class TextScroller {
+public:
+  /** Callback invoked when the last queued message has finished scrolling */
+  typedef void (*CompletionCallback)();
+
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for TextScroller
+   * @param matrix Reference to the LED matrix display object
+   */
+  TextScroller(Max72xxPanel& matrix);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Add a message to the end of the scroll queue
+   *
+   * The message is copied, so temporary buffers may be reused right away.
+   * Messages longer than MAX_MESSAGE_LENGTH characters are truncated.
+   *
+   * @param message The text message to scroll (null-terminated string)
+   * @return True if the message was queued, false if the queue is full
+   */
+  bool enqueue(const char* message);
+
+  /**
+   * @brief Add a flash-resident message to the end of the scroll queue
+   *
+   * Only the pointer is stored; the text is read from flash when the message
+   * starts, so it is never copied into RAM. Messages longer than
+   * MAX_MESSAGE_LENGTH characters are truncated.
+   *
+   * @param message The text message to scroll, e.g. F("Hello")
+   * @return True if the message was queued, false if the queue is full
+   */
+  bool enqueue(const __FlashStringHelper* message);
+
+  /**
+   * @brief Advance the scroll by one column if the next frame is due
+   *
+   * Draws the current frame, and moves on to the next queued message once
+   * the current one has scrolled out. Returns immediately when idle or when
+   * no frame is due.
+   *
+   * @note Call this method every loop iteration
+   */
+  void update();
+
+  /**
+   * @brief Set the callback invoked when the queue runs empty
+   * @param callback Function to call, or nullptr to disable
+   */
+  void setCompletionCallback(CompletionCallback callback) { completionCallback = callback; }
+
+  /**
+   * @brief Check if a message is currently scrolling or queued
+   * @return True if the scroller owns the display, false otherwise
+   */
+  bool isActive() const { return queuedMessages > 0; }
+
+private:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Maximum number of messages waiting to be scrolled (date, lat, lon, alt) */
+  static const int MAX_QUEUED_MESSAGES = 4;
+
+  /** Maximum number of characters stored per message */
+  static const int MAX_MESSAGE_LENGTH = 27;
+
+  /** Width of one character including spacing (pixels) */
+  static const int CHAR_WIDTH_PX = 6;
+
+  /** Time between scroll frames (milliseconds) */
+  static const int SCROLL_FRAME_INTERVAL_MS = 35;
+
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** Reference to the LED matrix display object */
+  Max72xxPanel& ledMatrix;
+
+  /** Message queue (circular buffer) */
+  char messageQueue[MAX_QUEUED_MESSAGES][MAX_MESSAGE_LENGTH + 1];
+
+  /** Flash message per queue slot (nullptr = text is in messageQueue) */
+  const __FlashStringHelper* flashMessages[MAX_QUEUED_MESSAGES];
+
+  /** Index of the message currently scrolling */
+  uint8_t headIndex;
+
+  /** Number of messages in the queue, including the one scrolling */
+  uint8_t queuedMessages;
+
+  /** X position of the current message's first column */
+  int scrollPositionX;
+
+  /** Total message width in pixels, including the trailing blank */
+  int messageWidth;
+
+  /** Text width of the current message in pixels, without the trailing blank */
+  int textWidth;
+
+  /** Character entering the display, rendered as columns (bit 0 = top row) */
+  uint8_t glyphColumns[CHAR_WIDTH_PX];
+
+  /** Index of the character in glyphColumns, -1 if none is rendered */
+  int8_t glyphIndex;
+
+  /** True until the first frame of the current message has been drawn */
+  bool fullRedraw;
+
+  /** Timestamp of the last drawn frame */
+  unsigned long lastFrameTime;
+
+  /** Callback invoked when the queue runs empty */
+  CompletionCallback completionCallback;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Prepare the message at the head of the queue for scrolling
+   *
+   * Places the message just past the right edge and computes its width.
+   */
+  void beginMessage();
+
+  /**
+   * @brief Get one column of the current message's text
+   * @param column Column from the start of the message (0 to textWidth - 1)
+   * @return Column pixels, bit 0 = top row
+   */
+  uint8_t messageColumn(int column);
+};
+
+#endif // TEXT_SCROLLER_H
@@ -0,0 +1,98 @@
+/**
+ * @file TimeSourceManager.cpp
+ * @brief Implementation of the TimeSourceManager class for RTC holdover
+ *
+ * This file contains the implementation of the TimeSourceManager class,
+ * which disciplines a DS3231 RTC from GPS and serves its time during outages.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "TimeSourceManager.h"
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for TimeSourceManager
+ * @param syncIntervalMs Minimum time between RTC discipline checks (milliseconds)
+ * @param staleAfterMs Holdover duration after which time is flagged stale (milliseconds)
+ *
+ * The RTC is not touched until begin() is called.
+ */
+TimeSourceManager::TimeSourceManager(unsigned long syncIntervalMs, unsigned long staleAfterMs)
+  : rtcPresent(false), rtcTimeValid(false), syncedThisBoot(false),
+    currentSource(TIME_SOURCE_NONE), lastGpsTime(0), lastRtcCheckTime(0),
+    syncInterval(syncIntervalMs), staleAfter(staleAfterMs) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Detect the RTC and check whether it kept time while powered off
+ * @return True if an RTC was found on the I2C bus, false otherwise
+ *
+ * The DS3231 oscillator stop flag tells whether the time survived the power
+ * cycle (backup battery present and good).
+ */
+bool TimeSourceManager::begin() {
+  rtcPresent = rtc.begin();
+  rtcTimeValid = rtcPresent && !rtc.lostPower();
+  return rtcPresent;
+}
+
+/**
+ * @brief Record a valid GPS time and discipline the RTC if due
+ * @param gpsUtc Current UTC time from the GPS fix
+ *
+ * The RTC is read back and only written when it differs from GPS time, at
+ * most once per sync interval (and right away on the first fix after boot).
+ */
+void TimeSourceManager::syncFromGps(const DateTime& gpsUtc) {
+  unsigned long currentTime = millis();
+  currentSource = TIME_SOURCE_GPS;
+  lastGpsTime = currentTime;
+
+  if (!rtcPresent) return;
+  if (syncedThisBoot && (unsigned long)(currentTime - lastRtcCheckTime) < syncInterval) return;
+
+  lastRtcCheckTime = currentTime;
+  if (!rtcTimeValid || rtc.now().unixtime() != gpsUtc.unixtime()) {
+    // Writing the time also clears the oscillator stop flag
+    rtc.adjust(gpsUtc);
+  }
+  rtcTimeValid = true;
+  syncedThisBoot = true;
+}
+
+/**
+ * @brief Read the holdover time from the RTC
+ * @param rtcUtc Receives the current UTC time from the RTC
+ * @return True if the RTC holds a valid time, false otherwise
+ */
+bool TimeSourceManager::readHoldoverTime(DateTime& rtcUtc) {
+  if (!rtcTimeValid) {
+    currentSource = TIME_SOURCE_NONE;
+    return false;
+  }
+
+  rtcUtc = rtc.now();
+  currentSource = TIME_SOURCE_RTC;
+  return true;
+}
+
+/**
+ * @brief Check if holdover has lasted longer than the staleness limit
+ * @return True if the RTC time should be treated as stale
+ */
+bool TimeSourceManager::isStale() const {
+  if (currentSource != TIME_SOURCE_RTC) return false;
+  if (!syncedThisBoot) return true;
+  return (unsigned long)(millis() - lastGpsTime) >= staleAfter;
+}
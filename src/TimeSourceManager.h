@@ -0,0 +1,142 @@
+/**
+ * @file TimeSourceManager.h
+ * @brief GPS time source with DS3231 RTC holdover
+ *
+ * This file contains the TimeSourceManager class that keeps a DS3231 real
+ * time clock disciplined from GPS time, and serves time from the RTC when
+ * the GPS signal is lost or not yet acquired after power up.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef TIME_SOURCE_MANAGER_H
+#define TIME_SOURCE_MANAGER_H
+
+#include <Arduino.h>
+#include <RTClib.h>
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * @enum TimeSource
+ * @brief Where the currently displayed time comes from
+ */
+enum TimeSource {
+  TIME_SOURCE_NONE,   /**< No valid time available */
+  TIME_SOURCE_GPS,    /**< Time from a current GPS fix */
+  TIME_SOURCE_RTC     /**< Time from the DS3231 RTC (holdover) */
+};
+
+// ============================================================================
+// TIME SOURCE MANAGER CLASS
+// ============================================================================
+
+/**
+ * @class TimeSourceManager
+ * @brief Disciplines a DS3231 from GPS and falls back to it during outages
+ *
+ * Features:
+ * - RTC set from GPS on the first fix and re-checked at a fixed interval
+ * - RTC writes only when the time actually differs (I2C traffic kept low)
+ * - Holdover time available right after power up if the RTC kept time
+ * - Staleness indicator once holdover exceeds a configured duration
+ *
+ * @note All times are UTC; timezone offsets are applied by the caller
+ */
+class TimeSourceManager {
+public:
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for TimeSourceManager
+   * @param syncIntervalMs Minimum time between RTC discipline checks (milliseconds)
+   * @param staleAfterMs Holdover duration after which time is flagged stale (milliseconds)
+   */
+  TimeSourceManager(unsigned long syncIntervalMs, unsigned long staleAfterMs);
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Detect the RTC and check whether it kept time while powered off
+   * @return True if an RTC was found on the I2C bus, false otherwise
+   */
+  bool begin();
+
+  /**
+   * @brief Record a valid GPS time and discipline the RTC if due
+   * @param gpsUtc Current UTC time from the GPS fix
+   */
+  void syncFromGps(const DateTime& gpsUtc);
+
+  /**
+   * @brief Read the holdover time from the RTC
+   * @param rtcUtc Receives the current UTC time from the RTC
+   * @return True if the RTC holds a valid time, false otherwise
+   */
+  bool readHoldoverTime(DateTime& rtcUtc);
+
+  /**
+   * @brief Check if the RTC can serve time during a GPS outage
+   * @return True if the RTC is present and holds a valid time
+   */
+  bool hasHoldoverTime() const { return rtcTimeValid; }
+
+  /**
+   * @brief Get the source of the last time handed out
+   * @return TIME_SOURCE_GPS, TIME_SOURCE_RTC or TIME_SOURCE_NONE
+   */
+  TimeSource getSource() const { return currentSource; }
+
+  /**
+   * @brief Check if holdover has lasted longer than the staleness limit
+   *
+   * Also true when serving RTC time that was not synced from GPS since
+   * power up, as its accuracy is unknown.
+   *
+   * @return True if the RTC time should be treated as stale
+   */
+  bool isStale() const;
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** DS3231 real time clock */
+  RTC_DS3231 rtc;
+
+  /** Whether an RTC was found on the I2C bus */
+  bool rtcPresent;
+
+  /** Whether the RTC holds a valid time (not lost power, or synced since) */
+  bool rtcTimeValid;
+
+  /** Whether the RTC has been synced from GPS since power up */
+  bool syncedThisBoot;
+
+  /** Source of the last time handed out */
+  TimeSource currentSource;
+
+  /** Timestamp of the last valid GPS time */
+  unsigned long lastGpsTime;
+
+  /** Timestamp of the last RTC discipline check */
+  unsigned long lastRtcCheckTime;
+
+  /** Minimum time between RTC discipline checks (milliseconds) */
+  unsigned long syncInterval;
+
+  /** Holdover duration after which time is flagged stale (milliseconds) */
+  unsigned long staleAfter;
+};
+
+#endif // TIME_SOURCE_MANAGER_H
@@ -0,0 +1,227 @@
+/**
+ * @file TimeZone.cpp
+ * @brief Implementation of the TimeZone class for local time conversion
+ *
+ * This file contains the built-in zone table and the implementation of the
+ * TimeZone class, which computes DST transitions with integer date
+ * arithmetic and caches the offset until the next one.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "TimeZone.h"
+
+// ============================================================================
+// ZONE TABLE
+// ============================================================================
+
+/** Zone without daylight saving time */
+#define NO_DST { 0, 0, 0, 0 }
+
+/**
+ * Built-in zones, with the equivalent POSIX TZ string for the DST zones.
+ * Transition times are local time before the transition, as in POSIX.
+ */
+static const TimeZoneRule TIME_ZONE_RULES[] PROGMEM = {
+  // name    standard  dst   start (month, week, weekday, minutes)  end
+  { "UTC",      0,      0,   NO_DST,               NO_DST },
+  { "GMT",      0,     60,   { 3, 5, 0, 60 },      { 10, 5, 0, 120 } },  // GMT0BST,M3.5.0/1,M10.5.0
+  { "CET",     60,    120,   { 3, 5, 0, 120 },     { 10, 5, 0, 180 } },  // CET-1CEST,M3.5.0,M10.5.0/3
+  { "EET",    120,    180,   { 3, 5, 0, 180 },     { 10, 5, 0, 240 } },  // EET-2EEST,M3.5.0/3,M10.5.0/4
+  { "MSK",    180,    180,   NO_DST,               NO_DST },
+  { "GST",    240,    240,   NO_DST,               NO_DST },
+  { "PKT",    300,    300,   NO_DST,               NO_DST },
+  { "IST",    330,    330,   NO_DST,               NO_DST },
+  { "NPT",    345,    345,   NO_DST,               NO_DST },
+  { "ICT",    420,    420,   NO_DST,               NO_DST },
+  { "SGT",    480,    480,   NO_DST,               NO_DST },
+  { "JST",    540,    540,   NO_DST,               NO_DST },
+  { "AEST",   600,    660,   { 10, 1, 0, 120 },    { 4, 1, 0, 180 } },   // AEST-10AEDT,M10.1.0,M4.1.0/3
+  { "NZST",   720,    780,   { 9, 5, 0, 120 },     { 4, 1, 0, 180 } },   // NZST-12NZDT,M9.5.0,M4.1.0/3
+  { "BRT",   -180,   -180,   NO_DST,               NO_DST },
+  { "EST",   -300,   -240,   { 3, 2, 0, 120 },     { 11, 1, 0, 120 } },  // EST5EDT,M3.2.0,M11.1.0
+  { "CST",   -360,   -300,   { 3, 2, 0, 120 },     { 11, 1, 0, 120 } },  // CST6CDT,M3.2.0,M11.1.0
+  { "MST",   -420,   -360,   { 3, 2, 0, 120 },     { 11, 1, 0, 120 } },  // MST7MDT,M3.2.0,M11.1.0
+  { "PST",   -480,   -420,   { 3, 2, 0, 120 },     { 11, 1, 0, 120 } },  // PST8PDT,M3.2.0,M11.1.0
+  { "AKST",  -540,   -480,   { 3, 2, 0, 120 },     { 11, 1, 0, 120 } },  // AKST9AKDT,M3.2.0,M11.1.0
+  { "HST",   -600,   -600,   NO_DST,               NO_DST },
+};
+
+/** Days before the first of each month in a non-leap year */
+static const uint16_t DAYS_BEFORE_MONTH[12] PROGMEM = {
+  0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+};
+
+/** Seconds per day */
+static const uint32_t SECONDS_PER_DAY = 86400UL;
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+/**
+ * @brief Constructor for TimeZone, starting with the first zone (UTC)
+ *
+ * The empty validity interval makes the first toLocal() fill the cache.
+ */
+TimeZone::TimeZone()
+  : validFrom(1), validUntil(0), offsetSeconds(0), zoneIndex(0), dstActive(false) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+/**
+ * @brief Get the number of zones in the table
+ * @return Zone count
+ */
+uint8_t TimeZone::count() {
+  return sizeof(TIME_ZONE_RULES) / sizeof(TIME_ZONE_RULES[0]);
+}
+
+/**
+ * @brief Look up a zone by name (case-insensitive)
+ * @param name Zone name, e.g. "IST"
+ * @return Zone index, or NOT_FOUND
+ */
+uint8_t TimeZone::find(const char* name) {
+  char zoneName[sizeof(TIME_ZONE_RULES[0].name)];
+  for (uint8_t i = 0; i < count(); i++) {
+    memcpy_P(zoneName, TIME_ZONE_RULES[i].name, sizeof(zoneName));
+    if (strcasecmp(name, zoneName) == 0) return i;
+  }
+  return NOT_FOUND;
+}
+
+/**
+ * @brief Print the name of a zone
+ * @param index Zone index (below count())
+ * @param output Destination, e.g. Serial
+ */
+void TimeZone::printName(uint8_t index, Print& output) {
+  char zoneName[sizeof(TIME_ZONE_RULES[0].name)];
+  memcpy_P(zoneName, TIME_ZONE_RULES[index].name, sizeof(zoneName));
+  output.print(zoneName);
+}
+
+/**
+ * @brief Select the zone used by toLocal()
+ * @param index Zone index
+ * @return False if the index is out of range (selection unchanged)
+ */
+bool TimeZone::select(uint8_t index) {
+  if (index >= count()) return false;
+  zoneIndex = index;
+  validFrom = 1;
+  validUntil = 0;
+  return true;
+}
+
+// ============================================================================
+// PRIVATE METHODS
+// ============================================================================
+
+/**
+ * @brief Recompute the offset and its validity interval for a UTC time
+ * @param utc Seconds since 1970-01-01 UTC
+ *
+ * Finds the two transitions of the year around the given time; the year is
+ * taken in local standard time, which is never near a transition.
+ */
+void TimeZone::updateCache(uint32_t utc) {
+  TimeZoneRule rule;
+  memcpy_P(&rule, &TIME_ZONE_RULES[zoneIndex], sizeof(rule));
+
+  if (rule.dstStart.month == 0) {
+    validFrom = 0;
+    validUntil = 0xFFFFFFFFUL;
+    offsetSeconds = rule.standardOffset * 60L;
+    dstActive = false;
+    return;
+  }
+
+  // Year of the time in local standard time
+  uint32_t local = utc + rule.standardOffset * 60L;
+  uint16_t year = 1970 + local / (SECONDS_PER_DAY * 365UL + SECONDS_PER_DAY / 4);
+  while (local < daysFromEpoch(year, 1, 1) * SECONDS_PER_DAY) year--;
+  while (local >= daysFromEpoch(year + 1, 1, 1) * SECONDS_PER_DAY) year++;
+
+  uint32_t start = transitionTime(rule.dstStart, year, rule.standardOffset);
+  uint32_t end = transitionTime(rule.dstEnd, year, rule.dstOffset);
+
+  if (start < end) {
+    // Northern hemisphere: DST within the year
+    if (utc < start) {
+      dstActive = false;
+      validFrom = transitionTime(rule.dstEnd, year - 1, rule.dstOffset);
+      validUntil = start;
+    } else if (utc < end) {
+      dstActive = true;
+      validFrom = start;
+      validUntil = end;
+    } else {
+      dstActive = false;
+      validFrom = end;
+      validUntil = transitionTime(rule.dstStart, year + 1, rule.standardOffset);
+    }
+  } else {
+    // Southern hemisphere: DST across the new year
+    if (utc < end) {
+      dstActive = true;
+      validFrom = transitionTime(rule.dstStart, year - 1, rule.standardOffset);
+      validUntil = end;
+    } else if (utc < start) {
+      dstActive = false;
+      validFrom = end;
+      validUntil = start;
+    } else {
+      dstActive = true;
+      validFrom = start;
+      validUntil = transitionTime(rule.dstEnd, year + 1, rule.dstOffset);
+    }
+  }
+
+  offsetSeconds = (dstActive ? rule.dstOffset : rule.standardOffset) * 60L;
+}
+
+/**
+ * @brief UTC time of a transition in a given year
+ * @param transition Transition rule
+ * @param year Calendar year
+ * @param offsetBefore Offset in effect before the transition (minutes)
+ * @return Seconds since 1970-01-01 UTC
+ */
+uint32_t TimeZone::transitionTime(const DstTransition& transition, uint16_t year, int16_t offsetBefore) {
+  uint16_t firstDay = daysFromEpoch(year, transition.month, 1);
+  uint16_t nextMonth = transition.month == 12 ? daysFromEpoch(year + 1, 1, 1)
+                                              : daysFromEpoch(year, transition.month + 1, 1);
+
+  // 1970-01-01 was a Thursday (weekday 4)
+  uint8_t firstWeekday = (firstDay + 4) % 7;
+  uint16_t day = firstDay + (transition.weekday + 7 - firstWeekday) % 7 + (transition.week - 1) * 7;
+  while (day >= nextMonth) day -= 7;  // Week 5: last occurrence in the month
+
+  return day * SECONDS_PER_DAY + (int32_t)(transition.localMinutes - offsetBefore) * 60L;
+}
+
+/**
+ * @brief Days from 1970-01-01 to a date
+ * @param year Calendar year (1970 or later)
+ * @param month Month (1-12)
+ * @param day Day of the month (1-31)
+ * @return Day number
+ */
+uint16_t TimeZone::daysFromEpoch(uint16_t year, uint8_t month, uint8_t day) {
+  // Leap years from 1970 up to the previous year (477 leap years up to 1969)
+  uint16_t previous = year - 1;
+  uint16_t leapDays = previous / 4 - previous / 100 + previous / 400 - 477;
+
+  uint16_t days = (year - 1970) * 365 + leapDays + pgm_read_word(&DAYS_BEFORE_MONTH[month - 1]) + day - 1;
+  bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  if (month > 2 && leapYear) days++;
+  return days;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file TimeZone.h
+ * @brief Time zone and daylight saving time rules with a transition cache
+ *
+ * This file contains the TimeZone class that converts UTC to local time for
+ * a zone selected at runtime from a table of POSIX TZ-style rules in flash.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef TIME_ZONE_H
+#define TIME_ZONE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * @struct DstTransition
+ * @brief One daylight saving transition, as the POSIX "Mm.w.d/time" form
+ */
+struct DstTransition {
+  uint8_t month;         /**< Month (1-12), 0 = zone without DST */
+  uint8_t week;          /**< Week of the month (1-4), 5 = last */
+  uint8_t weekday;       /**< Day of the week (0 = Sunday) */
+  int16_t localMinutes;  /**< Local time of the transition (minutes, time in effect before it) */
+};
+
+/**
+ * @struct TimeZoneRule
+ * @brief One entry of the zone table
+ *
+ * Offsets are east of UTC, i.e. the opposite sign of the POSIX TZ string:
+ * "CET-1CEST,M3.5.0,M10.5.0/3" has standardOffset 60 and dstOffset 120.
+ */
+struct TimeZoneRule {
+  char name[5];                /**< Short name used for selection, e.g. "CET" */
+  int16_t standardOffset;      /**< Standard time offset from UTC (minutes) */
+  int16_t dstOffset;           /**< Daylight saving time offset from UTC (minutes) */
+  DstTransition dstStart;      /**< Start of daylight saving time */
+  DstTransition dstEnd;        /**< End of daylight saving time */
+};
+
+// ============================================================================
+// TIME ZONE CLASS
+// ============================================================================
+
+/**
+ * @class TimeZone
+ * @brief Runtime-selectable UTC to local time conversion with DST
+ *
+ * The offset in effect and the UTC interval it is valid for (from the last
+ * transition to the next) are cached. Converting a time inside that interval
+ * is two compares and an add; only crossing a transition, or a jump in the
+ * UTC time, recomputes the transitions of the year.
+ *
+ * Features:
+ * - Built-in zone table in flash (TimeZone.cpp), selected by index or name
+ * - Northern and southern hemisphere rules (DST across the new year)
+ * - Integer date arithmetic, valid for 1970-2105
+ */
+class TimeZone {
+public:
+  // ========================================================================
+  // CONSTANTS
+  // ========================================================================
+
+  /** Returned by find() for unknown names */
+  static const uint8_t NOT_FOUND = 0xFF;
+
+  // ========================================================================
+  // CONSTRUCTOR
+  // ========================================================================
+
+  /**
+   * @brief Constructor for TimeZone, starting with the first zone (UTC)
+   */
+  TimeZone();
+
+  // ========================================================================
+  // PUBLIC METHODS
+  // ========================================================================
+
+  /**
+   * @brief Get the number of zones in the table
+   * @return Zone count
+   */
+  static uint8_t count();
+
+  /**
+   * @brief Look up a zone by name (case-insensitive)
+   * @param name Zone name, e.g. "IST"
+   * @return Zone index, or NOT_FOUND
+   */
+  static uint8_t find(const char* name);
+
+  /**
+   * @brief Print the name of a zone
+   * @param index Zone index (below count())
+   * @param output Destination, e.g. Serial
+   */
+  static void printName(uint8_t index, Print& output);
+
+  /**
+   * @brief Select the zone used by toLocal()
+   * @param index Zone index
+   * @return False if the index is out of range (selection unchanged)
+   */
+  bool select(uint8_t index);
+
+  /**
+   * @brief Get the selected zone
+   * @return Zone index
+   */
+  uint8_t selected() const { return zoneIndex; }
+
+  /**
+   * @brief Convert a UTC time to local time
+   * @param utc Seconds since 1970-01-01 UTC
+   * @return Local time in seconds since 1970-01-01
+   */
+  uint32_t toLocal(uint32_t utc) {
+    if (utc < validFrom || utc >= validUntil) updateCache(utc);
+    return utc + offsetSeconds;
+  }
+
+  /**
+   * @brief Get the offset of the last converted time
+   * @return Offset from UTC in seconds (east positive)
+   */
+  int32_t offset() const { return offsetSeconds; }
+
+  /**
+   * @brief Check if the last converted time was daylight saving time
+   * @return True during DST
+   */
+  bool isDst() const { return dstActive; }
+
+private:
+  // ========================================================================
+  // MEMBER VARIABLES
+  // ========================================================================
+
+  /** First UTC second the cached offset is valid for */
+  uint32_t validFrom;
+
+  /** First UTC second after the cached interval (next transition) */
+  uint32_t validUntil;
+
+  /** Cached offset from UTC (seconds) */
+  int32_t offsetSeconds;
+
+  /** Selected zone */
+  uint8_t zoneIndex;
+
+  /** Cached interval is daylight saving time */
+  bool dstActive;
+
+  // ========================================================================
+  // PRIVATE METHODS
+  // ========================================================================
+
+  /**
+   * @brief Recompute the offset and its validity interval for a UTC time
+   * @param utc Seconds since 1970-01-01 UTC
+   */
+  void updateCache(uint32_t utc);
+
+  /**
+   * @brief UTC time of a transition in a given year
+   * @param transition Transition rule
+   * @param year Calendar year
+   * @param offsetBefore Offset in effect before the transition (minutes)
+   * @return Seconds since 1970-01-01 UTC
+   */
+  static uint32_t transitionTime(const DstTransition& transition, uint16_t year, int16_t offsetBefore);
+
+  /**
+   * @brief Days from 1970-01-01 to a date
+   * @param year Calendar year (1970 or later)
+   * @param month Month (1-12)
+   * @param day Day of the month (1-31)
+   * @return Day number
+   */
+  static uint16_t daysFromEpoch(uint16_t year, uint8_t month, uint8_t day);
+};
+
+#endif // TIME_ZONE_H
@@ -20,13 +20,12 @@
 // ============================================================================
 
 #include <Arduino.h>
-#include <TinyGPS++.h>
-#include <TickTwo.h>
 #include <Adafruit_GFX.h>
 #include <Max72xxPanel.h>
 #include <RTClib.h>
 #include <TimerOne.h>
 #include <EEPROM.h>
+#include <avr/power.h>
 
 // ============================================================================
 // HARDWARE CONFIGURATION
@@ -36,7 +35,7 @@
  * @brief Hardware pin connections for the GPS Clock
  * 
  * GPS Module Connections:
- * - GPS RX: Not connected (GPS module only transmits)
+ * - GPS RX: Not connected by default; connect to Arduino TX1 (Digital Pin 1) to use GPS_RECEIVER_TYPE
  * - GPS TX: Connected to Arduino RX0 (Digital Pin 0)
  * 
  * LED Matrix Connections (4xMAX7219):
@@ -60,6 +59,31 @@
 const int LED_BRIGHTNESS_HIGH       = 10;  // High brightness level (0-15), used during day time
 const int LED_BRIGHTNESS_LOW        = 5;  // Low brightness level (0-15), used during night time
 
+/**
+ * @brief Ambient light sensor brightness control
+ *
+ * When enabled, an LDR divider on LIGHT_SENSOR_PIN (LDR from 5V to the pin,
+ * 10k from the pin to GND) sets the brightness between LED_BRIGHTNESS_LOW and
+ * LED_BRIGHTNESS_HIGH, sampled every LIGHT_SENSOR_SAMPLE_MS with smoothing
+ * and hysteresis. Replaces the time-of-day night mode.
+ */
+#define ENABLE_LIGHT_SENSOR         false
+#define LIGHT_SENSOR_PIN            A6    // Analog input of the LDR divider (A6/A7 are analog-only on the Nano)
+#define LIGHT_SENSOR_SAMPLE_MS      100   // Interval between light readings (smoothing spans ~16 readings)
+
+/**
+ * @brief Sunrise/sunset brightness schedule
+ *
+ * When enabled (and ENABLE_LIGHT_SENSOR is not), the brightness follows the
+ * sun at the GPS position: LED_BRIGHTNESS_HIGH by day, LED_BRIGHTNESS_LOW at
+ * night, ramping over SOLAR_RAMP_MINUTES around sunrise and sunset. Sunrise
+ * and sunset are computed once per day. Until the first GPS position is
+ * known, the fixed 21:00-06:00 night mode is used.
+ */
+#define ENABLE_SOLAR_BRIGHTNESS     true
+#define SOLAR_BRIGHTNESS_INTERVAL_MS 60000UL  // Interval between brightness updates along the ramp
+#define SOLAR_RAMP_MINUTES          60    // Duration of the dawn and dusk brightness ramps
+
 // ============================================================================
 // TIMING CONFIGURATION
 // ============================================================================
@@ -68,88 +92,251 @@ const int LED_BRIGHTNESS_LOW        = 5;  // Low brightness level (0-15), used d
 #define TIME_UPDATE_INTERVAL_MS     500  // Interval to check for GPS time updates (also affects seconds blinker)
 #define DATE_DISPLAY_INTERVAL_MS    (2 * 60 * 1000UL + 30 * 1000UL)  // Interval to display date (2 minutes 30 seconds)
 
+// Task Scheduler Deadlines (runtime budget per run, misses are counted)
+#define TASK_DEADLINE_GPS_US        2000UL   // GPS byte parsing and filter feed
+#define TASK_DEADLINE_FRAME_US      10000UL  // One animation/scroll frame including display write
+#define TASK_DEADLINE_CLOCK_US      10000UL  // Time update and display write
+#define TASK_DEADLINE_DATE_US       5000UL   // Date and location formatting (queues text only)
+#define TASK_DEADLINE_PROFILE_US    5000UL   // Profiling stats line (ENABLE_PROFILING only)
+#define TASK_DEADLINE_LIGHT_US      500UL    // Light sensor reading and intensity command (ENABLE_LIGHT_SENSOR only)
+#define TASK_DEADLINE_SOLAR_US      5000UL   // Daily sunrise/sunset computation (ENABLE_SOLAR_BRIGHTNESS only)
+#define TASK_DEADLINE_POWER_CYCLE_US 500UL  // Power cycle counter reset (queues a settings record)
+#define TASK_DEADLINE_SETTINGS_US   1000UL   // Settings record update and one EEPROM byte write
+#define TASK_DEADLINE_TELEMETRY_US  2000UL   // Telemetry packets into the serial transmit buffer (ENABLE_TELEMETRY only)
+
+// Rain Effect Frame Pacing
+#define RAIN_MAX_FPS                30    // Maximum rain frames written per second (0 = write every change)
+
+// Rain Effect Grey Levels: ground flashes fade through 3 grey levels, time
+// sliced from the Timer1 interrupt (one slot per GPS_CAPTURE_INTERVAL_US).
+// Costs 3 bytes per display row (96 bytes) while the rain effect is shown.
+#define ENABLE_GREYSCALE_RAIN       true
+
+// Idle Sleep: the CPU sleeps (SLEEP_MODE_IDLE) between scheduler passes until
+// the next interrupt (UART RX, Timer1 GPS capture, millis tick or PPS), and
+// the ADC is powered down when the light sensor is not used
+#define ENABLE_IDLE_SLEEP           true
+
+// Fast Boot: skip the startup animation and the welcome message so GPS
+// parsing and the RTC time display start within milliseconds of power up.
+// Power cycle detection does not depend on the boot sequence (see
+// POWER_CYCLE_WINDOW_MS), so the format toggle works the same either way.
+// Can also be set with -D ENABLE_FAST_BOOT=1 in build_flags.
+#ifndef ENABLE_FAST_BOOT
+#define ENABLE_FAST_BOOT            false
+#endif
+
 // GPS Signal Management
 const unsigned long GPS_SIGNAL_TIMEOUT_MS = 30000UL;  // GPS signal timeout (60 seconds) - rain effect shown if exceeded
 
+// GPS Serial Buffering
+#define GPS_RX_BUFFER_SIZE          128   // Ring buffer for GPS bytes (2-256), filled from the capture interrupt
+#define GPS_CAPTURE_INTERVAL_US     2000  // Capture interrupt period; must empty the 64-byte core buffer before it fills (5.5ms at 115200 baud)
+#define GPS_DRAIN_MAX_BYTES         64    // Maximum GPS bytes parsed per loop() iteration
+
+// GPS Coordinate Filter Feeding
+#define GPS_FILTER_UPDATE_INTERVAL_MS 1000  // Minimum time between filter readings (one per fix at 1 Hz)
+
+// ============================================================================
+// GPS RECEIVER CONFIGURATION
+// ============================================================================
+
+/**
+ * @brief GPS receiver startup configuration
+ * 
+ * When enabled, setup() tells the GPS module to output only RMC and GGA
+ * sentences, and optionally switches it to a different baud rate. This
+ * requires the GPS RX pin to be connected to Arduino TX1 (Digital Pin 1).
+ * 
+ * - GPS_RECEIVER_NONE:  Send nothing (GPS RX not connected)
+ * - GPS_RECEIVER_MTK:   MediaTek receivers (PMTK314 / PMTK251)
+ * - GPS_RECEIVER_UBLOX: u-blox receivers such as NEO-6M (UBX-CFG-MSG / PUBX,41)
+ */
+#define GPS_RECEIVER_NONE           0
+#define GPS_RECEIVER_MTK            1
+#define GPS_RECEIVER_UBLOX          2
+
+#define GPS_RECEIVER_TYPE           GPS_RECEIVER_NONE  // Receiver family to configure at startup
+#define GPS_SERIAL_BAUD_RATE        115200UL  // Baud rate the GPS module uses at power up
+#define GPS_CONFIG_BAUD_RATE        0UL       // Baud rate to switch the GPS module to (0 = keep GPS_SERIAL_BAUD_RATE)
+#define GPS_CONFIG_BOOT_DELAY_MS    500       // Time for the GPS module to boot before it accepts commands
+
 // Colon Blink Positions for Time Separator (x, y coordinates)
 byte COLON_BLINK_POSITIONS[][2] = {
   {14, 3}, {15, 3},  // Top row of colon
   {14, 4}, {15, 4}   // Bottom row of colon
 };
 
+// ============================================================================
+// RTC HOLDOVER CONFIGURATION
+// ============================================================================
+
+/**
+ * @brief DS3231 real time clock holdover
+ * 
+ * When enabled, a DS3231 on the I2C bus (SDA: A4, SCL: A5) is set from GPS
+ * and keeps the clock running during GPS outages and right after power up.
+ * While on RTC time, the top-right pixel is lit; it blinks once the RTC has
+ * not been synced from GPS for RTC_HOLDOVER_STALE_MS (or not since power up).
+ * Without an RTC connected the clock behaves as before.
+ */
+#define ENABLE_RTC_HOLDOVER         true
+#define RTC_SYNC_INTERVAL_MS        (10 * 60 * 1000UL)       // Interval between RTC checks against GPS time (10 minutes)
+#define RTC_HOLDOVER_STALE_MS       (24 * 60 * 60 * 1000UL)  // Holdover duration before time is flagged stale (24 hours)
+
+// ============================================================================
+// PPS SYNCHRONIZATION CONFIGURATION
+// ============================================================================
+
+/**
+ * @brief GPS PPS (pulse per second) synchronization
+ * 
+ * When enabled, the GPS module PPS output on GPS_PPS_PIN (must be an
+ * external interrupt pin: 2 or 3) marks the exact start of each UTC second.
+ * Digit updates and the colon toggle then land on the PPS edge instead of a
+ * 500ms polling tick. Without PPS pulses the clock falls back to polling.
+ * Can also be set with -D ENABLE_PPS_SYNC=1 (see env:nanoatmega328_profiling_pps).
+ */
+#ifndef ENABLE_PPS_SYNC
+#define ENABLE_PPS_SYNC             false
+#endif
+#define GPS_PPS_PIN                 2     // PPS input pin (INT0)
+#define PPS_MAX_FREEWHEEL_SECONDS   10    // PPS edges counted without a new NMEA time before falling back to polling
+
 // ============================================================================
 // TIMEZONE CONFIGURATION
 // ============================================================================
 
 /**
- * @brief Timezone offset configuration
+ * @brief Default time zone
  * 
- * Adjust these values to set your local timezone offset from UTC.
- * The TimeSpan constructor takes: (days, hours, minutes, seconds)
+ * Name of a zone in the built-in table (TimeZone.cpp), used until another
+ * zone is selected with the serial "TZ <name>" command. The selection is
+ * saved in EEPROM; DST transitions are applied automatically.
  * 
- * Common timezone examples:
- * - IST (UTC+5:30): DAYS=0, HOURS=5,  MINUTES=30, SECONDS=0
- * - EST (UTC-5:00): DAYS=0, HOURS=-5, MINUTES=0,  SECONDS=0
- * - PST (UTC-8:00): DAYS=0, HOURS=-8, MINUTES=0,  SECONDS=0
- * - GMT (UTC+0:00): DAYS=0, HOURS=0,  MINUTES=0,  SECONDS=0
- * - JST (UTC+9:00): DAYS=0, HOURS=9,  MINUTES=0,  SECONDS=0
- * - CET (UTC+1:00): DAYS=0, HOURS=1,  MINUTES=0,  SECONDS=0
- * - AEST(UTC+10:00):DAYS=0, HOURS=10, MINUTES=0,  SECONDS=0
+ * Zones: UTC, GMT (UK), CET, EET, MSK, GST, PKT, IST, NPT, ICT, SGT, JST,
+ * AEST (Sydney), NZST, BRT, EST, CST, MST, PST, AKST, HST
+ */
+#define TIMEZONE_DEFAULT        "IST"
+
+/**
+ * @brief Serial commands
  * 
- * Note: Use negative values for timezones west of UTC
+ * When enabled, lines received on the serial port that are not NMEA
+ * sentences are handled as commands (with the GPS module disconnected, or
+ * through its RX line):
+ * - "TZ"        show the selected zone and its current offset
+ * - "TZ?"       list the available zones
+ * - "TZ <name>" select a zone and save it
  */
-#define TIMEZONE_OFFSET_DAYS    0    // Days offset from UTC
-#define TIMEZONE_OFFSET_HOURS   5    // Hours offset from UTC (positive for east, negative for west)
-#define TIMEZONE_OFFSET_MINUTES 30   // Minutes offset from UTC
-#define TIMEZONE_OFFSET_SECONDS 0    // Seconds offset from UTC
+#define ENABLE_SERIAL_COMMANDS  true
+#define SERIAL_COMMAND_LENGTH   12    // Longest command line including the terminator
 
 // ============================================================================
 // GPS DISPLAY CONFIGURATION
 // ============================================================================
 
-// GPS Location Display Messages
-const char* GPS_LAT_PREFIX          = "LAT:";  // Latitude prefix
-const char* GPS_LON_PREFIX          = "LON:";  // Longitude prefix
-const char* GPS_ALT_PREFIX          = "ALT:";  // Altitude prefix
-const char* GPS_ALT_SUFFIX          = "ft";    // Altitude suffix (feet)
+// GPS Location Display Messages (stored in flash)
+const char GPS_LAT_PREFIX[] PROGMEM = "LAT:";  // Latitude prefix
+const char GPS_LON_PREFIX[] PROGMEM = "LON:";  // Longitude prefix
+const char GPS_ALT_PREFIX[] PROGMEM = "ALT:";  // Altitude prefix
+const char GPS_ALT_SUFFIX[] PROGMEM = "ft";    // Altitude suffix (feet)
+const char GPS_NO_SUFFIX[] PROGMEM  = "";      // No suffix (coordinates)
+
+// GPS Coordinate Precision Constants (filter values are fixed-point integers)
+#define GPS_COORD_DECIMALS              4        // 4 decimal places (~11m accuracy)
+#define GPS_COORD_DISPLAY_DIVISOR       1000L    // Degrees x 10^7 -> x 10^4
+#define GPS_ALT_DECIMALS                1        // 1 decimal place (tenths of feet)
 
-// GPS Coordinate Precision Constants
-#define GPS_COORD_PRECISION_MULTIPLIER  10000    // For 4 decimal places (~11m accuracy)
-#define GPS_ALT_PRECISION_MULTIPLIER    10       // For 1 decimal place
+// GPS Coordinate Filter Strategy
+// GPS_FILTER_AUTO: alpha-beta while moving, trimmed mean when stationary
+// GPS_FILTER_TRIMMED_MEAN: fixed installations; GPS_FILTER_ALPHA_BETA: vehicles
+#define GPS_FILTER_STRATEGY             GPS_FILTER_AUTO
 
 // ============================================================================
 // TEXT AND MESSAGES
 // ============================================================================
 
+// All fixed texts live in flash (PROGMEM) and are scrolled straight from
+// there; use FPSTR() to pass them where a flash string is expected.
+#ifndef FPSTR
+#define FPSTR(pstr) (reinterpret_cast<const __FlashStringHelper*>(pstr))
+#endif
+
 // Display Messages
-const char* WELCOME_MESSAGE         = "Arduino 32x8 GPS Clock";  // Welcome message displayed on startup
-const char* WAITING_FOR_GPS         = "Waiting for GPS Signal...";  // Message while waiting for GPS signal
+const char WELCOME_MESSAGE[] PROGMEM      = "Arduino 32x8 GPS Clock";  // Welcome message displayed on startup
+const char WAITING_FOR_GPS[] PROGMEM      = "Waiting for GPS Signal...";  // Message while waiting for GPS signal
 
 // Time Format Messages
-const char* FORMAT_12H_MESSAGE      = "12H FORMAT";   // 12-hour format toggle confirmation
-const char* FORMAT_24H_MESSAGE      = "24H FORMAT";   // 24-hour format toggle confirmation
+const char FORMAT_12H_MESSAGE[] PROGMEM   = "12H FORMAT";   // 12-hour format toggle confirmation
+const char FORMAT_24H_MESSAGE[] PROGMEM   = "24H FORMAT";   // 24-hour format toggle confirmation
 
 // Text Display Configuration
-const int TEXT_BUFFER_SIZE          = 75;  // Buffer size for scrolling text display
+const int TEXT_BUFFER_SIZE          = 28;  // Buffer for formatted text ("WED 31st DEC 2025", "LAT:-12.3456"), one scroller message
 
-// Date Formatting Arrays
-const char* WEEKDAY_NAMES[7]        = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT" };  // Abbreviated weekday names
-const char* MONTH_NAMES[12]         = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };  // Abbreviated month names
+// Date Formatting Arrays (fixed-width rows, read with the _P functions)
+const char WEEKDAY_NAMES[7][4] PROGMEM  = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT" };  // Abbreviated weekday names
+const char MONTH_NAMES[12][4] PROGMEM   = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };  // Abbreviated month names
 
 // ============================================================================
-// POWER CYCLE DETECTION CONFIGURATION
+// PERSISTENT SETTINGS CONFIGURATION
 // ============================================================================
 
-// EEPROM addresses for power cycle detection and time format storage
+// Settings journal: time format, time zone, brightness, power cycle count and
+// last known position in one record, rotated across the whole EEPROM (see SettingsStore.h)
+#define SETTINGS_EEPROM_ADDR       0
+#define SETTINGS_EEPROM_SIZE       (E2END + 1)  // 1024 bytes on the ATmega328
+#define SETTINGS_SAVE_INTERVAL_MS  600000UL  // Interval for saving brightness and position (unchanged values are not written)
+#define SETTINGS_POSITION_TOLERANCE_E7 10000L  // Position changes below ~100 m are not saved
+
+// Time format byte of firmware before the settings journal, read once when no
+// journal record exists yet
 #define EEPROM_TIME_FORMAT_ADDR    0    // 1 byte: 0=12H, 1=24H
-#define EEPROM_POWER_CYCLE_ADDR    1    // 4 bytes: power cycle count
+
+// ============================================================================
+// POWER CYCLE DETECTION CONFIGURATION
+// ============================================================================
+
 #define POWER_CYCLE_THRESHOLD      5    // Number of cycles needed to toggle format
+#define POWER_CYCLE_WINDOW_MS      3000UL  // Uptime after which a boot no longer counts as a power cycle
 
 // ============================================================================
 // DEBUG CONFIGURATION
 // ============================================================================
 
-#define ENABLE_SERIAL_DEBUG         true     // Set to true for debug output, false for production
+// Text debug output: scrolled messages and raw/filtered coordinates, printed
+// only when they are shown. Nothing is printed every second: the TX line also
+// drives the GPS module's RX, and the time is in the telemetry status packet.
+#define ENABLE_SERIAL_DEBUG         true     // Set to true for text debug output, false for production
+
+/**
+ * @brief Binary telemetry
+ *
+ * Sends COBS-framed binary packets (see Telemetry.h) over serial: a status
+ * packet every TELEMETRY_INTERVAL_MS, the raw and filtered position every
+ * TELEMETRY_POSITION_EVERY status packets and the health counters every
+ * TELEMETRY_HEALTH_EVERY. Decode on the host with tools/telemetry_decode.py.
+ * Costs a fraction of the CPU time and bandwidth of ENABLE_SERIAL_DEBUG,
+ * which should be turned off so the two don't mix.
+ *
+ * The TX line also drives the GPS module's RX (GpsModuleSetup), so the
+ * receiver sees every frame. Frames never contain '$' or 0xB5 (escaped, see
+ * Telemetry.h), so they cannot start an NMEA command or a UBX message.
+ * Off by default; enable it for production units that report to a host.
+ */
+#define ENABLE_TELEMETRY            false
+#define TELEMETRY_INTERVAL_MS       1000UL
+#define TELEMETRY_POSITION_EVERY    5     // Status packets per position packet
+#define TELEMETRY_HEALTH_EVERY      10    // Status packets per health packet
+
+// Profiling: loop timing, SPI time and GPS parse statistics printed over serial.
+// Enable with -D ENABLE_PROFILING=1 in build_flags (see env:nanoatmega328_profiling)
+// so the Max72xxPanel library is instrumented as well; compiled out otherwise.
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING            false
+#endif
+#define PROFILE_REPORT_INTERVAL_MS  5000UL   // Interval between profiling stats lines
+#define PROFILE_FRAME_BUDGET_US     25000UL  // Loop iterations longer than this delay an animation frame
 
 // ============================================================================
 // DATA STRUCTURES
@@ -175,15 +362,104 @@ struct TimeDigits {
 // FUNCTION PROTOTYPES
 // ============================================================================
 
+/**
+ * @brief Scheduler task: parses buffered GPS bytes and feeds the filter
+ * @return Always true
+ */
+bool runGpsTask();
+
+/**
+ * @brief Scheduler task: advances whatever currently owns the display
+ * @return Always true
+ */
+bool runDisplayFrameTask();
+
+/**
+ * @brief Scheduler task: updates the displayed time
+ * @return false while the time display is not active (task stays due)
+ */
+bool runClockTickTask();
+
+/**
+ * @brief Scheduler task: shows the date and location
+ * @return false while the time display is not active (task stays due)
+ */
+bool runDateDisplayTask();
+
+/**
+ * @brief Scheduler task: samples the light sensor and adjusts the brightness
+ * @return Always true
+ */
+bool runLightSensorTask();
+
+/**
+ * @brief Scheduler task: sets the brightness from the sunrise/sunset schedule
+ * @return false while no time is available (task stays due)
+ */
+bool runSolarBrightnessTask();
+
+/**
+ * @brief Brightness of the fixed night mode (low from 21:00 to 06:00)
+ * @return LED_BRIGHTNESS_LOW at night, LED_BRIGHTNESS_HIGH otherwise
+ */
+uint8_t nightModeBrightness();
+
+/**
+ * @brief Sleeps until the next interrupt unless GPS bytes are waiting
+ * Called from loop() after each scheduler pass (ENABLE_IDLE_SLEEP)
+ */
+void idleUntilInterrupt();
+
+/**
+ * @brief Sets the LED matrix intensity, skipping the command if unchanged
+ * @param level Intensity level (0-15)
+ */
+void setDisplayBrightness(uint8_t level);
+
+/**
+ * @brief Checks if the time display currently owns the LED matrix
+ * @return true if no text is scrolling and a time is available to show
+ */
+bool timeDisplayActive();
+
 /**
  * @brief Updates GPS time and displays it on the LED matrix
- * Called periodically by the GPS time update timer
+ * Called periodically by the clock tick task
  */
 void updateGpsTime();
 
+/**
+ * @brief Displays a UTC time on the LED matrix in local time
+ * @param utcDateTime Time to display (UTC)
+ */
+void displayTime(const DateTime& utcDateTime);
+
+/**
+ * @brief Creates a UTC DateTime from the last parsed GPS date and time
+ * @return Current GPS date and time (UTC)
+ */
+DateTime gpsUtcDateTime();
+
+/**
+ * @brief Draws the time separator colon
+ * @param visible true to light the colon, false to clear it
+ */
+void drawColon(bool visible);
+
+/**
+ * @brief PPS pin interrupt handler, latches the second edge
+ */
+void onPpsEdge();
+
+/**
+ * @brief Updates the display on PPS second edges
+ * Called every loop() iteration while time is valid
+ */
+void servicePpsClock();
+
 /**
  * @brief Displays the current date with ordinal suffixes
- * Called periodically by the date display timer
+ * Called periodically by the date display task
  */
 void displayDate();
 
@@ -193,6 +469,23 @@ void displayDate();
  */
 void displayGpsLocation();
 
+/**
+ * @brief Divides a signed value, rounding half away from zero
+ * @param value Value to divide
+ * @param divisor Positive divisor
+ * @return Rounded quotient
+ */
+int32_t roundedQuotient(int32_t value, int32_t divisor);
+
+/**
+ * @brief Formats a fixed-point value into textScrollBuffer as "<prefix><int>.<frac><suffix>"
+ * @param prefix Text placed before the number (flash string)
+ * @param value Value in units of 10^-decimals (e.g. 123456 with 4 decimals = 12.3456)
+ * @param decimals Number of fractional digits in value
+ * @param suffix Text placed after the number (flash string)
+ */
+void formatFixedPoint(PGM_P prefix, int32_t value, uint8_t decimals, PGM_P suffix);
+
 /**
  * @brief Configures LED matrix module positions and rotations
  * Sets up the display based on the selected configuration pattern
@@ -200,25 +493,35 @@ void displayGpsLocation();
 void configureLedMatrix();
 
 /**
- * @brief Scrolls text horizontally across the LED matrix display
+ * @brief Queues text to scroll horizontally across the LED matrix display
  * @param text The text message to scroll
  */
 void scrollTextHorizontally(const char* text);
 
 /**
- * @brief Creates a vertical sliding animation when time digits change
- * @param previousChar The character that was previously displayed
- * @param newChar The new character to display
- * @param xPosition The X coordinate where the animation occurs
+ * @brief Queues flash-resident text to scroll without copying it into RAM
+ * @param text The text message to scroll, e.g. FPSTR(WELCOME_MESSAGE)
+ */
+void scrollTextHorizontally(const __FlashStringHelper* text);
+
+/**
+ * @brief Runs the text scroller until all queued messages have been shown
+ * Only used during setup(), before the main loop takes over
  */
-void animateVerticalSlide(char previousChar, char newChar, int xPosition);
+void finishTextScroll();
+
+/**
+ * @brief Restores the time view once all queued text has scrolled
+ * Registered as the text scroller completion callback
+ */
+void onTextScrollComplete();
 
 /**
  * @brief Returns the appropriate ordinal suffix for a given number
  * @param number The number to get the ordinal suffix for
- * @return Pointer to the ordinal suffix string
+ * @return Flash pointer to the ordinal suffix string
  */
-const char* getOrdinalSuffix(int number);
+PGM_P getOrdinalSuffix(int number);
 
 /**
  * @brief Extracts individual digits from the current time for display
@@ -232,12 +535,113 @@ void extractTimeDigits(TimeDigits& digits);
  */
 void checkPowerCycles();
 
+/**
+ * @brief Scheduler task: clears the power cycle counter once the clock has
+ *        run for POWER_CYCLE_WINDOW_MS
+ * @return Always true
+ */
+bool runPowerCycleTask();
+
+/**
+ * @brief Scheduler task: writes the pending settings record to EEPROM
+ * @return true if an EEPROM byte write was started
+ */
+bool runSettingsWriteTask();
+
+/**
+ * @brief Scheduler task: saves the brightness and filtered position
+ * @return Always true
+ */
+bool runSettingsSaveTask();
+
+/**
+ * @brief Scheduler task: sends the binary telemetry packets
+ * @return Always true
+ */
+bool runTelemetryTask();
+
+/**
+ * @brief Collects serial input lines and runs them as commands
+ * @param receivedChar Character received on the serial port
+ */
+void handleCommandByte(char receivedChar);
+
+/**
+ * @brief Runs one serial command line
+ * @param command Null-terminated command line
+ */
+void runSerialCommand(const char* command);
+
+/**
+ * @brief Prints the selected time zone and its current offset
+ */
+void printTimeZone();
+
 /**
  * @brief Toggles between 12-hour and 24-hour time format
  * Stores the new format in EEPROM and shows confirmation on display
  */
 void toggleTimeFormat();
 
+/**
+ * @brief Parses buffered GPS bytes, bounded per call
+ * @param maxBytes Maximum number of bytes to parse in this call
+ */
+void drainGps(uint16_t maxBytes);
+
+/**
+ * @brief Feeds a newly parsed GPS location to the stability filter
+ * At most one reading per GPS_FILTER_UPDATE_INTERVAL_MS, called every loop() iteration
+ */
+void feedGpsFilter();
+
+/**
+ * @brief Moves GPS bytes from the serial port into the ring buffer
+ * Runs from the Timer1 interrupt every GPS_CAPTURE_INTERVAL_US, also drives
+ * the LED matrix grey level time slots (ENABLE_GREYSCALE_RAIN)
+ */
+void captureGpsBytes();
+
+#if ENABLE_PROFILING
+/**
+ * @brief Scheduler task: prints the profiling stats line
+ * @return Always true
+ */
+bool runProfileReportTask();
+
+/**
+ * @brief Prints one compact profiling stats line and starts a new interval
+ * Can be called at any time for an on-demand report
+ */
+void printProfileStats();
+
+/**
+ * @brief Prints one benchmark result line
+ * @param name Kernel name
+ * @param elapsedMicros Total time of all operations
+ * @param ops Number of operations timed
+ */
+void printBenchmark(const __FlashStringHelper* name, unsigned long elapsedMicros, uint16_t ops);
+
+/**
+ * @brief Times the rendering and filtering kernels and prints the results
+ * Runs once in setup() before the display is in use
+ */
+void benchmarkKernels();
+#endif
+
+/**
+ * @brief Sends startup configuration commands to the GPS receiver
+ * Disables unused NMEA sentences and optionally changes the baud rate
+ */
+void configureGpsReceiver();
+
+/**
+ * @brief Checks if there is a time to display, from GPS or RTC holdover
+ * @return true if GPS time is valid or the RTC holds a valid time
+ */
+bool validDisplayTime();
+
 /**
  * @brief Validates if GPS date and time are valid
  * @return true if both date and time from GPS are valid, false otherwise
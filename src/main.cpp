@@ -5,7 +5,7 @@
  * This Arduino project creates a GPS-synchronized clock that displays time on a 32x8 LED matrix.
  * The project is specifically designed for 4x MAX7219 modules arranged horizontally.
  * Features include:
- * - GPS time synchronization with timezone adjustment
+ * - GPS time synchronization with time zone and DST rules
  * - Animated time display with vertical slide transitions
  * - Date display with ordinal suffixes
  * - Rain effect animation when GPS signal is lost
@@ -21,17 +21,23 @@
 
 #include <config.h>
 #include "RainEffect.h"
+#include "GpsReceiver.h"
 #include "GpsStabilityFilter.h"
-
-// ============================================================================
-// CONSTANTS AND CONFIGURATION
-// ============================================================================
-
-// Space between characters in pixels for text scrolling
-const int CHAR_SPACING = 1;
-
-// Total character width including spacing for text scrolling
-const int CHAR_WIDTH = 5 + CHAR_SPACING;
+#include "DigitSlideAnimation.h"
+#include "TextScroller.h"
+#include "GpsRxBuffer.h"
+#include "GpsModuleSetup.h"
+#include "TimeSourceManager.h"
+#include "PpsClock.h"
+#include "TaskScheduler.h"
+#include "LightSensor.h"
+#include "SolarSchedule.h"
+#include "SettingsStore.h"
+#include "TimeZone.h"
+#include "Telemetry.h"
+#if ENABLE_PROFILING
+#include "LoopProfiler.h"
+#endif
 
 // ============================================================================
 // GLOBAL VARIABLES
@@ -40,9 +46,17 @@ const int CHAR_WIDTH = 5 + CHAR_SPACING;
 // ----------------------------------------------------------------------------
 // GPS AND SIGNAL TRACKING
 // ----------------------------------------------------------------------------
-TinyGPSPlus gpsModule;                    // GPS module interface
+GpsReceiver gpsModule;                    // GPS module interface (parser backend chosen at build time)
 bool wasShowingRainEffect = false;        // Track previous rain effect state for efficient screen clearing
+bool powerCycleCounted = false;           // This boot is counted as a power cycle until the window ends
 GpsStabilityFilter gpsFilter(gpsModule);  // GPS coordinates stability filter
+unsigned long lastFilterUpdateTime = 0;   // Time of the last reading fed to the stability filter
+uint8_t gpsRxStorage[GPS_RX_BUFFER_SIZE];  // Storage for the GPS receive ring buffer
+GpsRxBuffer gpsRxBuffer(Serial, gpsRxStorage, GPS_RX_BUFFER_SIZE);  // Interrupt-filled GPS receive buffer
+#if ENABLE_PROFILING
+volatile uint16_t captureBlockedMicros = 0;  // Longest capture interrupt time with interrupts off, this interval
+volatile uint16_t captureTotalMicros = 0;    // Longest capture interrupt time including the grey level refresh
+#endif
 
 // ----------------------------------------------------------------------------
 // TIME AND DATE MANAGEMENT
@@ -52,75 +66,229 @@ TimeDigits currentTimeDigits;             // Current time digits for display
 TimeDigits previousTimeDigits;            // Previous time digits for animation comparison
 bool is24Hour = false;                    // Time format cache (read once in setup for performance)
 bool toggleBlinker = false;               // Controls colon blinking state in time display
+#if ENABLE_RTC_HOLDOVER
+TimeSourceManager timeSource(RTC_SYNC_INTERVAL_MS, RTC_HOLDOVER_STALE_MS);  // GPS time with DS3231 holdover
+#endif
+#if ENABLE_PPS_SYNC
+PpsClock ppsClock(PPS_MAX_FREEWHEEL_SECONDS);  // Second boundaries from the GPS PPS edge
+#endif
 
 // ----------------------------------------------------------------------------
 // DISPLAY AND ANIMATION
 // ----------------------------------------------------------------------------
 Max72xxPanel ledMatrix = Max72xxPanel(MATRIX_CS_PIN, MATRIX_TOTAL_MODULES_X, MATRIX_TOTAL_MODULES_Y);
-RainEffect rainEffect(ledMatrix);         // Rain effect animation object
-char textScrollBuffer[TEXT_BUFFER_SIZE];  // Buffer for scrolling text display
+RainEffect rainEffect(ledMatrix, RAIN_MAX_FPS);  // Rain effect animation object
+DigitSlideAnimation digitSlideAnimation(ledMatrix);  // Non-blocking digit slide animation
+TextScroller textScroller(ledMatrix);     // Non-blocking scrolling text with message queue
+char textScrollBuffer[TEXT_BUFFER_SIZE];  // Buffer for formatting scrolling text
+uint8_t displayBrightness = 0xFF;         // Intensity last sent to the LED matrix (0xFF = none yet)
+#if ENABLE_LIGHT_SENSOR
+LightSensor lightSensor(LIGHT_SENSOR_PIN, LED_BRIGHTNESS_LOW, LED_BRIGHTNESS_HIGH);  // LDR brightness control
+#elif ENABLE_SOLAR_BRIGHTNESS
+SolarSchedule solarSchedule;              // Daily sunrise/sunset for the brightness ramp
+bool solarScheduleFromGps = false;        // Schedule computed from a GPS position rather than the saved one
+#endif
 
 // ----------------------------------------------------------------------------
-// TIMERS
+// PERSISTENT SETTINGS
 // ----------------------------------------------------------------------------
-TickTwo gpsTimeUpdateTicker(updateGpsTime, TIME_UPDATE_INTERVAL_MS);  // Timer for GPS time updates
-TickTwo dateDisplayTicker(displayDate, DATE_DISPLAY_INTERVAL_MS);     // Timer for date display
+SettingsStore settingsStore(SETTINGS_EEPROM_ADDR, SETTINGS_EEPROM_SIZE);  // Wear-levelled EEPROM settings journal
+TimeZone timeZone;                        // UTC to local time with DST, selected at runtime
+#if ENABLE_TELEMETRY
+Telemetry telemetry(Serial);              // COBS-framed binary telemetry packets
+uint8_t telemetryTicks = 0;               // Status packets sent, for the position/health intervals
+#endif
+#if ENABLE_SERIAL_COMMANDS
+char commandBuffer[SERIAL_COMMAND_LENGTH];  // Serial command line being received
+uint8_t commandLength = 0;                // Characters in commandBuffer (COMMAND_IGNORED = skip to end of line)
+const uint8_t COMMAND_IGNORED = 0xFF;
+#endif
+
+// ----------------------------------------------------------------------------
+// TASK SCHEDULER
+// ----------------------------------------------------------------------------
+SchedulerTask schedulerTasks[] = {
+  // name     callback             period (ms)               deadline (us)
+  { "gps",    runGpsTask,          0,                        TASK_DEADLINE_GPS_US },
+  { "frame",  runDisplayFrameTask, 0,                        TASK_DEADLINE_FRAME_US },
+  { "clock",  runClockTickTask,    TIME_UPDATE_INTERVAL_MS,  TASK_DEADLINE_CLOCK_US },
+  { "date",   runDateDisplayTask,  DATE_DISPLAY_INTERVAL_MS, TASK_DEADLINE_DATE_US },
+  { "cycle",  runPowerCycleTask,   POWER_CYCLE_WINDOW_MS,    TASK_DEADLINE_POWER_CYCLE_US },
+  { "eeprom", runSettingsWriteTask, 0,                       TASK_DEADLINE_SETTINGS_US },
+  { "save",   runSettingsSaveTask, SETTINGS_SAVE_INTERVAL_MS, TASK_DEADLINE_SETTINGS_US },
+  #if ENABLE_LIGHT_SENSOR
+  { "light",  runLightSensorTask,  LIGHT_SENSOR_SAMPLE_MS,   TASK_DEADLINE_LIGHT_US },
+  #elif ENABLE_SOLAR_BRIGHTNESS
+  { "solar",  runSolarBrightnessTask, SOLAR_BRIGHTNESS_INTERVAL_MS, TASK_DEADLINE_SOLAR_US },
+  #endif
+  #if ENABLE_TELEMETRY
+  { "telem",  runTelemetryTask,    TELEMETRY_INTERVAL_MS,    TASK_DEADLINE_TELEMETRY_US },
+  #endif
+  #if ENABLE_PROFILING
+  { "prof",   runProfileReportTask, PROFILE_REPORT_INTERVAL_MS, TASK_DEADLINE_PROFILE_US },
+  #endif
+};
+TaskScheduler taskScheduler(schedulerTasks, sizeof(schedulerTasks) / sizeof(schedulerTasks[0]));  // Runs the task table from loop()
+#if ENABLE_PROFILING
+LoopProfiler loopProfiler(PROFILE_FRAME_BUDGET_US, TIME_UPDATE_INTERVAL_MS);  // Loop timing, GPS throughput and colon jitter statistics
+#endif
 
 /**
  * @brief Arduino setup function - initializes the GPS clock system
  * 
  * This function performs the following initialization steps:
- * 1. Initializes serial communication for debugging
+ * 1. Initializes serial communication, configures the GPS receiver and starts GPS byte capture
  * 2. Configures the LED matrix display
  * 3. Runs a startup animation
  * 4. Displays welcome message
- * 5. Starts the GPS time update and date display timers
+ * 5. Starts the task scheduler (GPS time update and date display tasks)
+ *
+ * With ENABLE_FAST_BOOT, steps 3 and 4 are skipped and a format toggle
+ * message scrolls from the scheduler, so setup() returns without blocking.
  * 
  * @note This function runs once when the Arduino starts up
  */
 void setup() {
-  Serial.begin(115200);
+  Serial.begin(GPS_SERIAL_BAUD_RATE);
   while (!Serial) delay(100);
+  configureGpsReceiver();
+  gpsFilter.setStrategy(GPS_FILTER_STRATEGY);
+
+  #if ENABLE_RTC_HOLDOVER
+  // Detect the RTC so time can be shown before the first GPS fix
+  timeSource.begin();
+  #endif
 
-  // Initialize LED matrix with low brightness
-  ledMatrix.setIntensity(LED_BRIGHTNESS_LOW);
+  #if ENABLE_PPS_SYNC
+  // Latch the GPS second edge for display updates on the exact UTC boundary
+  pinMode(GPS_PPS_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(GPS_PPS_PIN), onPpsEdge, RISING);
+  #endif
+
+  // Capture GPS bytes from a timer interrupt so blocking work can't overrun the serial buffer
+  Timer1.initialize(GPS_CAPTURE_INTERVAL_US);
+  Timer1.attachInterrupt(captureGpsBytes);
+
+  // Load the settings; older firmware kept only the time format at address 0
+  settingsStore.begin(LED_BRIGHTNESS_LOW, EEPROM.read(EEPROM_TIME_FORMAT_ADDR) == 1, TimeZone::find(TIMEZONE_DEFAULT));
+  is24Hour = settingsStore.is24Hour();
+  if (!timeZone.select(settingsStore.timeZone())) {
+    timeZone.select(TimeZone::find(TIMEZONE_DEFAULT));
+  }
+
+  // Initialize LED matrix with the last brightness, or the ambient light level
+  #if ENABLE_LIGHT_SENSOR
+  lightSensor.begin();
+  setDisplayBrightness(lightSensor.level());
+  #else
+  setDisplayBrightness(settingsStore.brightness());
+  #endif
   ledMatrix.fillScreen(LOW);
   ledMatrix.write();
   configureLedMatrix();
 
-  // Read time format from EEPROM once
-  uint8_t format = EEPROM.read(EEPROM_TIME_FORMAT_ADDR);
-  is24Hour = (format == 1);
+  #if ENABLE_PROFILING
+  // Time the rendering and filtering kernels once on the real hardware
+  benchmarkKernels();
+  #endif
+  textScroller.setCompletionCallback(onTextScrollComplete);
 
   // Detect power cycles for time format switching
   checkPowerCycles();
 
-  // Fun startup animation: randomly light up LEDs (increased delay for power cycle detection)
   randomSeed(analogRead(A0));
+
+  #if ENABLE_IDLE_SLEEP && !ENABLE_LIGHT_SENSOR
+  // No more analog readings after the random seed: power the ADC down
+  ADCSRA &= ~_BV(ADEN);
+  power_adc_disable();
+  #endif
+
+  #if !ENABLE_FAST_BOOT
+  finishTextScroll();
+
+  // Fun startup animation: randomly light up LEDs (GPS bytes parsed meanwhile)
   for (int i = 0; i < ledMatrix.width() * ledMatrix.height(); i++) {
     ledMatrix.drawPixel(random(ledMatrix.width()), random(ledMatrix.height()), HIGH);
     ledMatrix.write();
     delay(5);
+    drainGps(GPS_DRAIN_MAX_BYTES);
   }
 
-  // Display welcome message and start timers
-  scrollTextHorizontally(WELCOME_MESSAGE);
-
-  // Reset power cycle counter after welcome message
-  EEPROM.put(EEPROM_POWER_CYCLE_ADDR, (unsigned long)0);
+  // Display welcome message
+  scrollTextHorizontally(FPSTR(WELCOME_MESSAGE));
+  finishTextScroll();
+  #endif
 
-  gpsTimeUpdateTicker.start();
-  dateDisplayTicker.start();
+  // The power cycle counter is cleared by the scheduler once the window ends
+  taskScheduler.begin();
 }
 
 void loop() {
-  while (Serial.available()){
-    char receivedChar = Serial.read();
-    gpsModule.encode(receivedChar);
-  }
+  #if ENABLE_PROFILING
+  loopProfiler.loopStart();
+  #endif
+  taskScheduler.dispatch();
 
-  if (validGpsDateTime()) {
-    // GPS signal good - clear screen if transitioning from rain effect
+  #if ENABLE_IDLE_SLEEP
+  idleUntilInterrupt();
+  #endif
+}
+
+#if ENABLE_IDLE_SLEEP
+/**
+ * @brief Sleeps until the next interrupt unless GPS bytes are waiting
+ * 
+ * After a scheduler pass there is nothing to do until an interrupt brings
+ * new work: a GPS byte (UART RX and the Timer1 capture), the millis() tick
+ * that makes the next task or animation frame due, or the PPS edge. Bytes
+ * left in the ring buffer (GPS_DRAIN_MAX_BYTES limit) are parsed first.
+ */
+void idleUntilInterrupt() {
+  if (gpsRxBuffer.available() > 0) return;
+
+  #if ENABLE_PROFILING
+  loopProfiler.idleStart();
+  #endif
+
+  taskScheduler.idle();
+
+  #if ENABLE_PROFILING
+  loopProfiler.idleEnd();
+  #endif
+}
+#endif
+
+/**
+ * @brief Scheduler task: parses buffered GPS bytes and feeds the filter
+ * @return Always true
+ */
+bool runGpsTask() {
+  drainGps(GPS_DRAIN_MAX_BYTES);
+  feedGpsFilter();
+  return true;
+}
+
+/**
+ * @brief Scheduler task: advances whatever currently owns the display
+ * 
+ * Scrolling text has priority; otherwise the time display (PPS edge and digit
+ * slide frames) runs while a time is available, and the rain effect when not.
+ * 
+ * @return Always true
+ */
+bool runDisplayFrameTask() {
+  #if ENABLE_GREYSCALE_RAIN
+  // Grey levels are only used by the rain effect; the other views write the
+  // display directly, which greyscale mode leaves to the Timer1 interrupt
+  ledMatrix.setGreyscale(!textScroller.isActive() && !validDisplayTime());
+  #endif
+
+  if (textScroller.isActive()) {
+    // Scrolling text owns the display until its queue runs empty
+    textScroller.update();
+  } else if (validDisplayTime()) {
+    // GPS signal (or RTC holdover) good - clear screen if transitioning from rain effect
     // This prevents rain drops from being visible with time display
     if (wasShowingRainEffect) {
       ledMatrix.fillScreen(LOW);
@@ -128,15 +296,440 @@ void loop() {
       wasShowingRainEffect = false;
     }
 
-    gpsTimeUpdateTicker.update();
-    dateDisplayTicker.update();
+    #if ENABLE_PPS_SYNC
+    servicePpsClock();
+    #endif
+    digitSlideAnimation.update();
   }else{
-    // GPS signal lost - show rain effect
+    // GPS signal lost and no RTC time - show rain effect
+    digitSlideAnimation.cancel();
     if (!rainEffect.isInitialized()) rainEffect.initialize();
+    if (!wasShowingRainEffect) rainEffect.invalidate();  // Clear the previous view right away
+
+    // render() only writes the display when a drop or flash visibly changed
     rainEffect.update();
     rainEffect.render();
     wasShowingRainEffect = true;
   }
+  return true;
+}
+
+#if ENABLE_LIGHT_SENSOR
+/**
+ * @brief Scheduler task: samples the light sensor and adjusts the brightness
+ * 
+ * The intensity command is only sent when the smoothed light level crosses
+ * into a new brightness level.
+ * 
+ * @return Always true
+ */
+bool runLightSensorTask() {
+  if (lightSensor.update()) {
+    setDisplayBrightness(lightSensor.level());
+  }
+  return true;
+}
+#elif ENABLE_SOLAR_BRIGHTNESS
+/**
+ * @brief Scheduler task: sets the brightness from the sunrise/sunset schedule
+ * 
+ * Sunrise and sunset are recomputed only when the UTC day changes; in
+ * between this is just a comparison against the cached times. Until the
+ * GPS filter has a position, the saved position is used, or the fixed
+ * night mode without one.
+ * 
+ * @return false while no time is available, so the brightness is set as
+ *         soon as the clock shows a time
+ */
+bool runSolarBrightnessTask() {
+  if (!validDisplayTime()) return false;
+
+  bool gpsPosition = gpsFilter.hasFilteredPosition();
+  if (!gpsPosition && !settingsStore.hasPosition() && !solarSchedule.isValid()) {
+    setDisplayBrightness(nightModeBrightness());
+    return true;
+  }
+
+  DateTime utcDateTime(currentDateTime.unixtime() - timeZone.offset());
+  uint16_t dayOfYear = (utcDateTime.unixtime() - DateTime(utcDateTime.year(), 1, 1).unixtime()) / 86400UL + 1;
+  if (gpsPosition) {
+    // Recompute once when the first fix replaces the saved position
+    if (!solarScheduleFromGps) solarSchedule.invalidate();
+    solarScheduleFromGps = true;
+    solarSchedule.update(gpsFilter.getFilteredLatitudeE7(), gpsFilter.getFilteredLongitudeE7(), dayOfYear);
+  } else if (settingsStore.hasPosition()) {
+    // Position saved before the last power down, until the first fix
+    solarSchedule.update(settingsStore.latitudeE7(), settingsStore.longitudeE7(), dayOfYear);
+  }
+
+  uint16_t utcMinutes = utcDateTime.hour() * 60 + utcDateTime.minute();
+  setDisplayBrightness(solarSchedule.brightness(utcMinutes, LED_BRIGHTNESS_LOW, LED_BRIGHTNESS_HIGH, SOLAR_RAMP_MINUTES));
+  return true;
+}
+#endif
+
+/**
+ * @brief Brightness of the fixed night mode (low from 21:00 to 06:00)
+ * @return LED_BRIGHTNESS_LOW at night, LED_BRIGHTNESS_HIGH otherwise
+ */
+uint8_t nightModeBrightness() {
+  if (currentDateTime.hour() >= 21 || currentDateTime.hour() <= 6) {
+    // Night hours: 9PM to 6AM - use low brightness
+    return LED_BRIGHTNESS_LOW;
+  }
+  // Day hours: 6AM to 9PM - use high brightness
+  return LED_BRIGHTNESS_HIGH;
+}
+
+/**
+ * @brief Sets the LED matrix intensity, skipping the command if unchanged
+ * @param level Intensity level (0-15)
+ */
+void setDisplayBrightness(uint8_t level) {
+  if (level == displayBrightness) return;
+  displayBrightness = level;
+  ledMatrix.setIntensity(level);
+  settingsStore.setBrightness(level);  // Saved with the next settings record
+}
+
+/**
+ * @brief Checks if the time display currently owns the LED matrix
+ * @return true if no text is scrolling and a time is available to show
+ */
+bool timeDisplayActive() {
+  return !textScroller.isActive() && validDisplayTime();
+}
+
+/**
+ * @brief Scheduler task: updates the displayed time every TIME_UPDATE_INTERVAL_MS
+ * @return false while the time display is not active, so the update runs
+ *         as soon as it is
+ */
+bool runClockTickTask() {
+  if (!timeDisplayActive()) return false;
+  updateGpsTime();
+  return true;
+}
+
+/**
+ * @brief Scheduler task: shows the date every DATE_DISPLAY_INTERVAL_MS
+ * @return false while the time display is not active, so the date is shown
+ *         as soon as it is
+ */
+bool runDateDisplayTask() {
+  if (!timeDisplayActive()) return false;
+  displayDate();
+  return true;
+}
+
+/**
+ * @brief Sends startup configuration commands to the GPS receiver
+ * 
+ * Reduces the NMEA output of the GPS module to RMC and GGA, which is all the
+ * clock parses. Fewer bytes per second means less capture and parse time and
+ * less risk of buffer overruns while text scrolls. If GPS_CONFIG_BAUD_RATE is
+ * set, the module and the serial port are then switched to that baud rate.
+ * 
+ * @note Does nothing when GPS_RECEIVER_TYPE is GPS_RECEIVER_NONE
+ * @note Debug output shares the TX line with these commands; GPS modules
+ *       ignore anything that isn't a valid command
+ */
+void configureGpsReceiver() {
+  #if GPS_RECEIVER_TYPE != GPS_RECEIVER_NONE
+  GpsModuleSetup gpsSetup(Serial);
+
+  // Give the GPS module time to boot before sending commands
+  delay(GPS_CONFIG_BOOT_DELAY_MS);
+
+  #if GPS_RECEIVER_TYPE == GPS_RECEIVER_MTK
+  gpsSetup.configureMtkSentences();
+  #elif GPS_RECEIVER_TYPE == GPS_RECEIVER_UBLOX
+  gpsSetup.configureUbloxSentences();
+  #endif
+
+  #if GPS_CONFIG_BAUD_RATE != 0
+  #if GPS_RECEIVER_TYPE == GPS_RECEIVER_MTK
+  gpsSetup.setMtkBaudRate(GPS_CONFIG_BAUD_RATE);
+  #elif GPS_RECEIVER_TYPE == GPS_RECEIVER_UBLOX
+  gpsSetup.setUbloxBaudRate(GPS_CONFIG_BAUD_RATE);
+  #endif
+
+  // Wait until the command has left the UART before changing our own baud rate
+  Serial.flush();
+  Serial.begin(GPS_CONFIG_BAUD_RATE);
+  #endif
+  #endif
+}
+
+/**
+ * @brief Timer1 interrupt handler that captures GPS bytes
+ * 
+ * Empties the core serial receive buffer into the larger GPS ring buffer,
+ * then shows the next grey level time slot of the LED matrix (only does
+ * anything while the rain effect has greyscale on).
+ * 
+ * A grey level slot can resend all 8 rows to the 4 modules, about 230us at
+ * SPI_CLOCK_DIV4. The USART holds less than 3 bytes (about 260us at 115200
+ * baud) while its receive interrupt is blocked, and loses the next one
+ * without any count in GpsRxStats. So interrupts are enabled again for the
+ * refresh: only the capture itself runs with them off.
+ * 
+ * @note Runs in interrupt context every GPS_CAPTURE_INTERVAL_US microseconds
+ */
+void captureGpsBytes() {
+  #if ENABLE_PROFILING
+  unsigned long startMicros = micros();
+  #endif
+
+  gpsRxBuffer.capture();
+
+  #if ENABLE_PROFILING
+  uint16_t blockedMicros = micros() - startMicros;
+  if (blockedMicros > captureBlockedMicros) captureBlockedMicros = blockedMicros;
+  #endif
+
+  #if ENABLE_GREYSCALE_RAIN
+  // Only the rows use SPI; a refresh running late is never re-entered
+  static volatile bool refreshing = false;
+  if (!refreshing) {
+    refreshing = true;
+    interrupts();
+    ledMatrix.refreshGreyscale();
+    noInterrupts();
+    refreshing = false;
+  }
+  #endif
+
+  #if ENABLE_PROFILING
+  uint16_t totalMicros = micros() - startMicros;
+  if (totalMicros > captureTotalMicros) captureTotalMicros = totalMicros;
+  #endif
+}
+
+/**
+ * @brief Feeds buffered GPS bytes to the NMEA parser
+ * 
+ * Parses at most maxBytes per call so a burst of NMEA data can't stall the
+ * rest of the loop; remaining bytes stay buffered for the next iteration.
+ * 
+ * @param maxBytes Maximum number of bytes to parse in this call
+ */
+void drainGps(uint16_t maxBytes) {
+  #if ENABLE_PROFILING
+  uint16_t budget = maxBytes;
+  #endif
+
+  while (maxBytes > 0 && gpsRxBuffer.available()) {
+    char receivedChar = gpsRxBuffer.read();
+    #if ENABLE_SERIAL_COMMANDS
+    handleCommandByte(receivedChar);
+    #endif
+    #if ENABLE_PPS_SYNC
+    // Note the PPS edge now: labelling waits for the display, which can be
+    // one edge later (text scrolling, late frame task)
+    if (gpsModule.encode(receivedChar) && gpsModule.isTimeUpdated()) ppsClock.captureSentenceEdge();
+    #else
+    gpsModule.encode(receivedChar);
+    #endif
+    maxBytes--;
+  }
+
+  #if ENABLE_PROFILING
+  loopProfiler.addParsedBytes(budget - maxBytes);
+  #endif
+}
+
+#if ENABLE_PROFILING
+/**
+ * @brief Scheduler task: prints the profiling stats line
+ * @return Always true
+ */
+bool runProfileReportTask() {
+  printProfileStats();
+  return true;
+}
+
+/**
+ * @brief Prints one compact profiling stats line and starts a new interval
+ * 
+ * Example: "PROF loop:84/310/24012us ovr:0 gps:402B/s colon:1210us spi:1830us/41wr nmea:40/0 rx:0/0 isr:96/310us"
+ * - loop: min/avg/max loop() iteration time, ovr: iterations over PROFILE_FRAME_BUDGET_US
+ * - gps: bytes parsed per second
+ * - colon: largest deviation of a colon toggle from the TIME_UPDATE_INTERVAL_MS period
+ * - spi: time spent in Max72xxPanel SPI transfers and write() calls in this interval
+ * - nmea: sentences with passed/failed checksum since boot (after the sentence filter)
+ * - rx: GPS bytes dropped from the ring buffer / hardware serial overflows since boot
+ * - isr: longest capture interrupt with interrupts off / including the grey
+ *   level refresh in this interval
+ * - pps (ENABLE_PPS_SYNC): latency from the last PPS edge to its display update,
+ *   or "-" while the PPS clock is not locked
+ * 
+ * Under simulation (test/wokwi) with a scripted NMEA stream, these fields are
+ * the pass criteria for timing: ovr and rx stay 0, colon stays well below
+ * one frame.
+ * 
+ * @note The serial RX line belongs to the GPS, so reports are periodic or
+ *       triggered from code by calling this function
+ */
+void printProfileStats() {
+  Serial.print(F("PROF "));
+  loopProfiler.printStats(Serial);
+
+  #if MAX72XX_PROFILING
+  Serial.print(F(" spi:"));
+  Serial.print(ledMatrix.getSpiMicros());
+  Serial.print(F("us/"));
+  Serial.print(ledMatrix.getWriteCount());
+  Serial.print(F("wr"));
+  ledMatrix.resetProfile();
+  #endif
+
+  Serial.print(F(" nmea:"));
+  Serial.print(gpsModule.passedChecksums());
+  Serial.print('/');
+  Serial.print(gpsModule.failedChecksums());
+
+  GpsRxStats rxStats;
+  gpsRxBuffer.getStats(rxStats);
+  Serial.print(F(" rx:"));
+  Serial.print(rxStats.bytesDropped);
+  Serial.print('/');
+  Serial.print(rxStats.hardwareOverflows);
+
+  noInterrupts();
+  uint16_t blockedMicros = captureBlockedMicros;
+  uint16_t totalMicros = captureTotalMicros;
+  captureBlockedMicros = 0;
+  captureTotalMicros = 0;
+  interrupts();
+  Serial.print(F(" isr:"));
+  Serial.print(blockedMicros);
+  Serial.print('/');
+  Serial.print(totalMicros);
+  Serial.print(F("us"));
+
+  #if ENABLE_PPS_SYNC
+  Serial.print(F(" pps:"));
+  if (ppsClock.isLocked()) {
+    Serial.print(ppsClock.getDisplayLatencyMicros());
+    Serial.print(F("us"));
+  } else {
+    Serial.print('-');
+  }
+  #endif
+  Serial.println();
+}
+
+/**
+ * @brief Prints one benchmark result line: "BENCH <name>: <total>us/<ops> = <per op>us"
+ * @param name Kernel name
+ * @param elapsedMicros Total time of all operations
+ * @param ops Number of operations timed
+ */
+void printBenchmark(const __FlashStringHelper* name, unsigned long elapsedMicros, uint16_t ops) {
+  Serial.print(F("BENCH "));
+  Serial.print(name);
+  Serial.print(F(": "));
+  Serial.print(elapsedMicros);
+  Serial.print(F("us/"));
+  Serial.print(ops);
+  Serial.print(F(" = "));
+  Serial.print(elapsedMicros / ops);
+  Serial.println(F("us"));
+}
+
+/**
+ * @brief Times the rendering and filtering kernels and prints the results
+ * 
+ * Runs each kernel a fixed number of times on the real display, so results
+ * are comparable between builds (same wiring, same SPI clock). One cycle is
+ * 62.5 ns at 16 MHz, i.e. 16 cycles per microsecond.
+ * 
+ * @note Runs once in setup() with ENABLE_PROFILING, before the display is in use
+ */
+void benchmarkKernels() {
+  unsigned long start;
+  int16_t width = ledMatrix.width();
+  int16_t height = ledMatrix.height();
+
+  // drawPixel: every pixel on, then every pixel off
+  start = micros();
+  for (int16_t y = 0; y < height; y++) {
+    for (int16_t x = 0; x < width; x++) {
+      ledMatrix.drawPixel(x, y, HIGH);
+    }
+  }
+  for (int16_t y = 0; y < height; y++) {
+    for (int16_t x = 0; x < width; x++) {
+      ledMatrix.drawPixel(x, y, LOW);
+    }
+  }
+  printBenchmark(F("drawPixel"), micros() - start, 2 * width * height);
+
+  // write(): all rows, then a single changed row
+  const uint16_t writeOps = 16;
+  start = micros();
+  for (uint16_t i = 0; i < writeOps; i++) {
+    ledMatrix.forceFullWrite();
+  }
+  printBenchmark(F("write full"), micros() - start, writeOps);
+
+  start = micros();
+  for (uint16_t i = 0; i < writeOps; i++) {
+    ledMatrix.drawPixel(0, 0, i & 1);
+    ledMatrix.write();
+  }
+  printBenchmark(F("write 1 row"), micros() - start, writeOps);
+
+  // Glyph drawing: one digit as used by the time display
+  const uint16_t glyphOps = 32;
+  start = micros();
+  for (uint16_t i = 0; i < glyphOps; i++) {
+    ledMatrix.drawChar(0, 0, '8', HIGH, LOW, 1);
+  }
+  printBenchmark(F("drawChar"), micros() - start, glyphOps);
+
+  // Rain effect frame (update + forced render, including its display write)
+  const uint16_t rainOps = 32;
+  rainEffect.initialize();
+  start = micros();
+  for (uint16_t i = 0; i < rainOps; i++) {
+    rainEffect.update();
+    rainEffect.invalidate();
+    rainEffect.render();
+  }
+  printBenchmark(F("rain frame"), micros() - start, rainOps);
+
+  // GPS filter getters (update() needs a fix, which setup() doesn't have yet)
+  const uint16_t filterOps = 32;
+  start = micros();
+  for (uint16_t i = 0; i < filterOps; i++) {
+    gpsFilter.getFilteredLatitudeE7();
+    gpsFilter.getFilteredLongitudeE7();
+    gpsFilter.getFilteredAltitudeCm();
+  }
+  printBenchmark(F("filter"), micros() - start, filterOps);
+
+  ledMatrix.fillScreen(LOW);
+  ledMatrix.write();
+}
+#endif
+
+/**
+ * @brief Feeds a newly parsed GPS location to the stability filter
+ * 
+ * Runs in the background on every fix, so the filter window spans the last
+ * GPS_FILTER_WINDOW_SIZE fixes rather than the last few date screens. Each
+ * call adds at most one reading, and only after GPS_FILTER_UPDATE_INTERVAL_MS,
+ * which keeps the cost per loop() iteration small and bounded.
+ */
+void feedGpsFilter() {
+  unsigned long currentTime = millis();
+  if (currentTime - lastFilterUpdateTime < GPS_FILTER_UPDATE_INTERVAL_MS) return;
+  if (!gpsModule.isLocationUpdated()) return;
+
+  lastFilterUpdateTime = currentTime;
+  gpsFilter.update();
 }
 
 /**
@@ -148,77 +741,190 @@ void loop() {
  * @return true if GPS location, date, and time are valid and recent; false otherwise.
  */
 bool validGpsDateTime() {
-  return gpsModule.location.isValid() &&
-         gpsModule.location.age() < GPS_SIGNAL_TIMEOUT_MS &&
-         gpsModule.date.isValid() &&
-         gpsModule.time.isValid();
+  return gpsModule.isLocationValid() &&
+         gpsModule.locationAge() < GPS_SIGNAL_TIMEOUT_MS &&
+         gpsModule.isDateValid() &&
+         gpsModule.isTimeValid();
+}
+
+/**
+ * @brief Checks if there is a time to display, from GPS or RTC holdover.
+ * 
+ * @return true if GPS date and time are valid and recent, or the RTC holds
+ *         a valid time to fall back on; false otherwise.
+ */
+bool validDisplayTime() {
+  #if ENABLE_RTC_HOLDOVER
+  if (timeSource.hasHoldoverTime()) return true;
+  #endif
+  return validGpsDateTime();
 }
 
 /**
  * @brief Updates GPS time and displays it on the LED matrix
  * 
- * This function is called periodically by the GPS time update timer. It:
- * 1. Validates GPS data availability
- * 2. Converts GPS time to local timezone (configurable)
- * 3. Extracts individual time digits
- * 4. Animates digit changes with vertical slide effect
- * 5. Displays PM indicator and blinking colon
+ * This function is called periodically by the clock tick task. It:
+ * 1. Takes UTC time from GPS (disciplining the RTC), or from the RTC during outages
+ * 2. Displays it through displayTime() and toggles the colon blinker
  * 
  * @note This function is called every TIME_UPDATE_INTERVAL_MS milliseconds
- * @note Timezone offset is configurable in config.h via TIMEZONE_OFFSET_* defines
+ * @note While the PPS clock is locked, servicePpsClock() updates the display instead
  */
 void updateGpsTime() {
-  if (gpsModule.date.isValid() && gpsModule.time.isValid()) {
-    // Create DateTime object from GPS data with timezone adjustment
-    // Timezone offset is configured in config.h
-    currentDateTime = DateTime(
-      gpsModule.date.year(), gpsModule.date.month(), gpsModule.date.day(),
-      gpsModule.time.hour(), gpsModule.time.minute(), gpsModule.time.second()
-    ) + TimeSpan(TIMEZONE_OFFSET_DAYS, TIMEZONE_OFFSET_HOURS, TIMEZONE_OFFSET_MINUTES, TIMEZONE_OFFSET_SECONDS);
-
-    // Extract individual digits for display
-    extractTimeDigits(currentTimeDigits);
-
-    // Animate digit changes with vertical slide effect
-    if (currentTimeDigits.minOnes != previousTimeDigits.minOnes) {
-      animateVerticalSlide(previousTimeDigits.minOnes, currentTimeDigits.minOnes, 25);
-    }
+  #if ENABLE_PPS_SYNC
+  if (ppsClock.isLocked()) return;
+  #endif
 
-    if (currentTimeDigits.minTens != previousTimeDigits.minTens) {
-      animateVerticalSlide(previousTimeDigits.minTens, currentTimeDigits.minTens, 18);
-    }
+  DateTime utcDateTime;
 
-    if (currentTimeDigits.hourOnes != previousTimeDigits.hourOnes) {
-      animateVerticalSlide(previousTimeDigits.hourOnes, currentTimeDigits.hourOnes, 7);
-    }
+  if (validGpsDateTime()) {
+    utcDateTime = gpsUtcDateTime();
 
-    if (currentTimeDigits.hourTens != previousTimeDigits.hourTens) {
-      animateVerticalSlide(previousTimeDigits.hourTens, currentTimeDigits.hourTens, 1);
-    }
+    #if ENABLE_RTC_HOLDOVER
+    timeSource.syncFromGps(utcDateTime);
+    #endif
+  }
+  #if ENABLE_RTC_HOLDOVER
+  else if (!timeSource.readHoldoverTime(utcDateTime)) {
+    return;
+  }
+  #else
+  else {
+    return;
+  }
+  #endif
 
-    // Display PM indicator in bottom-right corner (only in 12-hour format)
-    if (!is24Hour) {
-      ledMatrix.drawPixel(ledMatrix.width() - 1, ledMatrix.height() - 1, currentDateTime.isPM());
-    }
+  displayTime(utcDateTime);
+  toggleBlinker = !toggleBlinker;
+}
 
-    // Toggle the colon blinker for time separator
-    for (byte i = 0; i < sizeof(COLON_BLINK_POSITIONS) / sizeof(COLON_BLINK_POSITIONS[0]); i++) {
-      ledMatrix.drawPixel(COLON_BLINK_POSITIONS[i][0], COLON_BLINK_POSITIONS[i][1], toggleBlinker);
-    }
+/**
+ * @brief Creates a UTC DateTime from the last parsed GPS date and time
+ * @return Current GPS date and time (UTC)
+ */
+DateTime gpsUtcDateTime() {
+  return DateTime(
+    gpsModule.year(), gpsModule.month(), gpsModule.day(),
+    gpsModule.hour(), gpsModule.minute(), gpsModule.second()
+  );
+}
 
-    ledMatrix.write();
+/**
+ * @brief Displays a UTC time on the LED matrix in local time
+ * 
+ * This function:
+ * 1. Converts UTC time to local time in the selected zone (DST included)
+ * 2. Extracts individual time digits
+ * 3. Starts vertical slide animations for changed digits (non-blocking)
+ * 4. Displays PM indicator, RTC holdover indicator and the colon (per toggleBlinker)
+ * 
+ * @param utcDateTime Time to display (UTC)
+ * 
+ * @note The offset is cached until the next DST transition, so the
+ *       conversion is an interval check and an add
+ */
+void displayTime(const DateTime& utcDateTime) {
+  // Apply the time zone offset in effect at this instant
+  currentDateTime = DateTime(timeZone.toLocal(utcDateTime.unixtime()));
 
-    // Print timestamp to serial when seconds change (debug only)
-    #if ENABLE_SERIAL_DEBUG
-    if (currentTimeDigits.secOnes != previousTimeDigits.secOnes) {
-      Serial.println(currentDateTime.timestamp(DateTime::TIMESTAMP_FULL));
-    }
+  // Extract individual digits for display
+  extractTimeDigits(currentTimeDigits);
+
+  // Animate digit changes with vertical slide effect (frames are drawn from loop())
+  if (currentTimeDigits.minOnes != previousTimeDigits.minOnes) {
+    digitSlideAnimation.start(previousTimeDigits.minOnes, currentTimeDigits.minOnes, 25);
+  }
+
+  if (currentTimeDigits.minTens != previousTimeDigits.minTens) {
+    digitSlideAnimation.start(previousTimeDigits.minTens, currentTimeDigits.minTens, 18);
+  }
+
+  if (currentTimeDigits.hourOnes != previousTimeDigits.hourOnes) {
+    digitSlideAnimation.start(previousTimeDigits.hourOnes, currentTimeDigits.hourOnes, 7);
+  }
+
+  if (currentTimeDigits.hourTens != previousTimeDigits.hourTens) {
+    digitSlideAnimation.start(previousTimeDigits.hourTens, currentTimeDigits.hourTens, 1);
+  }
+
+  // Display PM indicator in bottom-right corner (only in 12-hour format)
+  if (!is24Hour) {
+    ledMatrix.drawPixel(ledMatrix.width() - 1, ledMatrix.height() - 1, currentDateTime.isPM());
+  }
+
+  #if ENABLE_RTC_HOLDOVER
+  // Display RTC holdover indicator in top-right corner (steady on RTC time, blinking once stale)
+  bool onHoldover = timeSource.getSource() == TIME_SOURCE_RTC;
+  ledMatrix.drawPixel(ledMatrix.width() - 1, 0, onHoldover && (!timeSource.isStale() || toggleBlinker));
+  #endif
+
+  // Draw the colon blinker for time separator
+  drawColon(toggleBlinker);
+
+  ledMatrix.write();
+
+  // Update previous digits for next comparison
+  extractTimeDigits(previousTimeDigits);
+}
+
+#if ENABLE_PPS_SYNC
+/**
+ * @brief PPS pin interrupt handler
+ * 
+ * @note Runs in interrupt context on every rising PPS edge
+ */
+void onPpsEdge() {
+  ppsClock.captureEdge();
+}
+
+/**
+ * @brief Updates the display on PPS second edges
+ * 
+ * Labels PPS edges with freshly parsed NMEA time, then on every new edge
+ * shows the second that just started with the colon on, and clears the
+ * colon half a second later. The RTC is disciplined from the edge time, which
+ * is more accurate than the NMEA arrival time.
+ * 
+ * @note Called every loop() iteration while time is valid
+ */
+void servicePpsClock() {
+  if (ppsClock.hasSentenceEdge() && validGpsDateTime()) {
+    ppsClock.labelSentenceEdge(gpsUtcDateTime().unixtime());
+  }
+
+  uint32_t edgeUnixTime;
+  if (ppsClock.takeSecondEdge(edgeUnixTime)) {
+    DateTime utcDateTime(edgeUnixTime);
+
+    #if ENABLE_RTC_HOLDOVER
+    timeSource.syncFromGps(utcDateTime);
     #endif
 
-    // Update previous digits for next comparison
-    extractTimeDigits(previousTimeDigits);
-    toggleBlinker = !toggleBlinker;
+    toggleBlinker = true;
+    displayTime(utcDateTime);
+    ppsClock.markDisplayed();
+    toggleBlinker = false;
+  } else if (!toggleBlinker && ppsClock.isLocked() && ppsClock.millisSinceEdge() >= TIME_UPDATE_INTERVAL_MS) {
+    // Second half of the second: colon off
+    drawColon(false);
+    ledMatrix.write();
+    toggleBlinker = true;
+  }
+}
+#endif
+
+/**
+ * @brief Draws the time separator colon
+ * @param visible true to light the colon, false to clear it
+ */
+void drawColon(bool visible) {
+  for (byte i = 0; i < sizeof(COLON_BLINK_POSITIONS) / sizeof(COLON_BLINK_POSITIONS[0]); i++) {
+    ledMatrix.drawPixel(COLON_BLINK_POSITIONS[i][0], COLON_BLINK_POSITIONS[i][1], visible);
   }
+
+  #if ENABLE_PROFILING
+  loopProfiler.recordColon(visible);
+  #endif
 }
 
 /**
@@ -249,17 +955,18 @@ void configureLedMatrix() {
 }
 
 /**
- * @brief Scrolls text horizontally across the LED matrix display
+ * @brief Queues text to scroll horizontally across the LED matrix display
  * 
- * This function creates a smooth horizontal scrolling effect for text messages.
- * The text scrolls from right to left across the display. If the text is shorter
- * than the display width, it will still scroll to ensure visibility.
+ * The message is added to the text scroller queue and scrolls from right to
+ * left once earlier messages have finished. This function returns right away;
+ * the scroll itself is advanced from loop(). If the text is shorter than the
+ * display width, it will still scroll to ensure visibility.
  * 
  * @param message The text message to scroll (null-terminated string)
  * 
- * @note The function adds a space at the end of the message for better readability
- * @note Scroll speed is controlled by the delay(30) - adjust for different speeds
- * @note This function resets the previousTimeDigits to prevent animation conflicts
+ * @note A blank character is added at the end of the message for better readability
+ * @note Scroll speed is controlled by TextScroller (35ms per frame)
+ * @note The message is copied, so textScrollBuffer may be reused right away
  * 
  * @example
  * scrollTextHorizontally("Hello World"); // Scrolls "Hello World " across display
@@ -270,29 +977,53 @@ void scrollTextHorizontally(const char* message) {
   Serial.println(message);
   #endif
 
-  // Prepare text buffer with trailing space for better readability
-  snprintf(textScrollBuffer, sizeof(textScrollBuffer), "%s ", message);
+  textScroller.enqueue(message);
+}
 
-  // Calculate total text width in pixels
-  int totalTextWidth = strlen(textScrollBuffer) * CHAR_WIDTH;
-  
-  // Ensure minimum scroll distance is at least the display width
-  if (totalTextWidth < ledMatrix.width()) {
-    totalTextWidth = ledMatrix.width();
-  }
+/**
+ * @brief Queues flash-resident text to scroll horizontally across the display
+ * 
+ * Same as scrollTextHorizontally(const char*), but only the flash pointer is
+ * queued: the text is read from flash when it starts scrolling.
+ * 
+ * @param message The text message to scroll, e.g. FPSTR(WELCOME_MESSAGE)
+ * 
+ * @example
+ * scrollTextHorizontally(F("Hello World")); // Text stays in flash
+ */
+void scrollTextHorizontally(const __FlashStringHelper* message) {
+  #if ENABLE_SERIAL_DEBUG
+  Serial.println(message);
+  #endif
 
-  // Scroll text from right edge to left edge
-  for (int xPosition = ledMatrix.width(); xPosition >= -totalTextWidth; xPosition--) {
-    // Clear display and set cursor position
-    ledMatrix.fillScreen(LOW);
-    ledMatrix.setCursor(xPosition, 0);
-    ledMatrix.print(textScrollBuffer);
-    ledMatrix.write();
-    delay(35); // Control scroll speed (35ms per frame)
+  textScroller.enqueue(message);
+}
+
+/**
+ * @brief Runs the text scroller until all queued messages have been shown
+ * 
+ * Only used during setup(), where messages must finish before the next
+ * startup step. In loop() the scroller is advanced cooperatively instead.
+ * GPS bytes are parsed meanwhile, so the capture interrupt keeps filling a
+ * buffer that has room.
+ */
+void finishTextScroll() {
+  while (textScroller.isActive()) {
+    textScroller.update();
+    drainGps(GPS_DRAIN_MAX_BYTES);
   }
+}
 
+/**
+ * @brief Called by the text scroller when its message queue runs empty
+ * 
+ * Resets the previous time digits so the time view is redrawn with slide
+ * animations on the next time update.
+ */
+void onTextScrollComplete() {
   // Reset previous time digits to prevent animation conflicts
   previousTimeDigits = TimeDigits();
+  digitSlideAnimation.cancel();
 }
 
 /**
@@ -301,11 +1032,13 @@ void scrollTextHorizontally(const char* message) {
  * This function is called periodically by the date display timer. It:
  * 1. Checks if GPS time is acquired, shows waiting message if not
  * 2. Formats the date with weekday, day with ordinal suffix, month, and year
- * 3. Scrolls the formatted date across the display
+ * 3. Queues the formatted date and GPS location for scrolling
  * 4. Adjusts LED brightness based on time of day (night mode)
  * 
  * @note Called every DATE_DISPLAY_INTERVAL_MS milliseconds
  * @note Night mode: low brightness from 9PM to 6AM, high brightness otherwise
+ *       (not used with ENABLE_LIGHT_SENSOR or ENABLE_SOLAR_BRIGHTNESS, their
+ *       scheduler tasks set the brightness)
  * @note Date format: "Mon 1st Jan 2024" (example)
  * 
  * @example
@@ -313,9 +1046,9 @@ void scrollTextHorizontally(const char* message) {
  * // Display will show: "Mon 1st Jan 2024"
  */
 void displayDate() {
-  // Show waiting message if GPS time is not valid
-  if (!gpsModule.time.isValid()) {
-    scrollTextHorizontally(WAITING_FOR_GPS);
+  // Show waiting message if neither GPS nor RTC time is valid
+  if (!validDisplayTime()) {
+    scrollTextHorizontally(FPSTR(WAITING_FOR_GPS));
     return;
   }
 
@@ -326,11 +1059,12 @@ void displayDate() {
   // Format date string with ordinal suffix
   // Format: "Day OrdinalSuffix Month Year" (e.g., "Mon 1st Jan 2024")
   int day = currentDateTime.day();
-  const char* ordinalSuffix = getOrdinalSuffix(day);
+  PGM_P ordinalSuffix = getOrdinalSuffix(day);
 
-  snprintf(
+  // All name strings are in flash: "%S" reads its argument with the _P functions
+  snprintf_P(
     textScrollBuffer, sizeof(textScrollBuffer),
-    "%s %d%s %s %d",
+    PSTR("%S %d%S %S %d"),
     WEEKDAY_NAMES[dayOfWeek],
     day,
     ordinalSuffix,
@@ -342,14 +1076,10 @@ void displayDate() {
   scrollTextHorizontally(textScrollBuffer);
   displayGpsLocation();
 
+  #if !ENABLE_LIGHT_SENSOR && !ENABLE_SOLAR_BRIGHTNESS
   // Adjust brightness based on time of day (night mode)
-  if (currentDateTime.hour() >= 21 || currentDateTime.hour() <= 6) {
-    // Night hours: 9PM to 6AM - use low brightness
-    ledMatrix.setIntensity(LED_BRIGHTNESS_LOW);
-  } else {
-    // Day hours: 6AM to 9PM - use high brightness
-    ledMatrix.setIntensity(LED_BRIGHTNESS_HIGH);
-  }
+  setDisplayBrightness(nightModeBrightness());
+  #endif
 }
 
 /**
@@ -360,7 +1090,7 @@ void displayDate() {
  * and regular cases for other numbers.
  * 
  * @param number The number to get the ordinal suffix for
- * @return Pointer to the ordinal suffix string ("st", "nd", "rd", or "th")
+ * @return Flash pointer to the ordinal suffix string ("st", "nd", "rd", or "th")
  * 
  * @note This is a helper function for date formatting
  * 
@@ -371,20 +1101,20 @@ void displayDate() {
  * getOrdinalSuffix(11) // Returns "th" (11th)
  * getOrdinalSuffix(21) // Returns "st" (21st)
  */
-const char* getOrdinalSuffix(int number) {
+PGM_P getOrdinalSuffix(int number) {
   int lastTwoDigits = number % 100;
   int lastDigit = number % 10;
 
   // Special case: 11th, 12th, 13th all use "th"
   if (lastTwoDigits >= 11 && lastTwoDigits <= 13) {
-    return "th";
+    return PSTR("th");
   } else {
     // Regular cases based on last digit
     switch (lastDigit) {
-      case 1: return "st";
-      case 2: return "nd";
-      case 3: return "rd";
-      default: return "th";
+      case 1: return PSTR("st");
+      case 2: return PSTR("nd");
+      case 3: return PSTR("rd");
+      default: return PSTR("th");
     }
   }
 }
@@ -428,35 +1158,6 @@ void extractTimeDigits(TimeDigits& digits) {
   digits.secTens = (second / 10) + '0';
 }
 
-/**
- * @brief Creates a vertical sliding animation when time digits change
- * 
- * This function creates a smooth vertical sliding effect when a time digit changes.
- * The old character slides down while the new character slides up from the top,
- * creating a visually appealing transition effect.
- * 
- * @param previousChar The character that was previously displayed
- * @param newChar The new character to display
- * @param xPosition The X coordinate where the animation occurs
- * 
- * @note Animation speed is controlled by delay(25) - adjust for different speeds
- * @note This function blocks execution during animation
- * 
- * @example
- * animateVerticalSlide('5', '6', 25); // Animate change from '5' to '6' at x=25
- */
-void animateVerticalSlide(char previousChar, char newChar, int xPosition) {
-  // Create sliding effect by moving both characters vertically
-  for (uint8_t yPosition = 0; yPosition <= ledMatrix.height(); yPosition++) {
-    // Draw new character sliding up from top
-    ledMatrix.drawChar(xPosition, yPosition - ledMatrix.height(), newChar, HIGH, LOW, 1);
-    // Draw previous character sliding down
-    ledMatrix.drawChar(xPosition, yPosition, previousChar, HIGH, LOW, 1);
-    ledMatrix.write();
-    delay(25); // Control animation speed (25ms per frame)
-  }
-}
-
 /**
  * @brief Displays GPS location information (latitude, longitude, altitude)
  * 
@@ -470,71 +1171,111 @@ void animateVerticalSlide(char previousChar, char newChar, int xPosition) {
  * @note Each coordinate is displayed on a separate line with scrolling
  * @note GPS precision is fixed at 4 decimal places for optimal readability
  * @note All values are validated before display to prevent invalid data
- * @note Uses integer arithmetic to avoid sprintf floating-point issues on Arduino
+ * @note Formats the fixed-point filter values directly (no float math, which Arduino sprintf lacks)
  */
 void displayGpsLocation() {
-  if (!gpsModule.location.isValid()) return;
-
-  // Update GPS stability filter with new readings
-  gpsFilter.update();
+  if (!gpsModule.isLocationValid()) return;
 
+  // Filtered values are kept current by feedGpsFilter() in the background
   // Display latitude using filtered value for stability (4 decimal places = ~11m accuracy)
-  float lat = gpsFilter.getFilteredLatitude();
-  int latInt = (int)lat;
-  float latDecimal = lat - latInt;
-  int latFrac = (int)(latDecimal * GPS_COORD_PRECISION_MULTIPLIER);
+  int32_t latE7 = gpsFilter.getFilteredLatitudeE7();
   
   #if ENABLE_SERIAL_DEBUG
-  // Debug output: show raw vs filtered values
-  Serial.print("LAT - Raw: ");
-  Serial.print(gpsModule.location.lat(), 6);
-  Serial.print(", Filtered: ");
-  Serial.print(lat, 6);
-  Serial.print(", Readings: ");
-  Serial.println(gpsFilter.getTotalReadings());
+  // Debug output: show raw vs filtered values (degrees x 10^7)
+  Serial.print(F("LAT - Raw: "));
+  Serial.print(gpsModule.latitudeE7());
+  Serial.print(F(", Filtered: "));
+  Serial.print(latE7);
+  Serial.print(F(", Readings: "));
+  Serial.print(gpsFilter.getTotalReadings());
+  Serial.print(F(", Moving: "));
+  Serial.println(gpsFilter.isMoving() ? "yes" : "no");
+
+  // Debug output: GPS receive buffer health
+  GpsRxStats rxStats;
+  gpsRxBuffer.getStats(rxStats);
+  Serial.print(F("RX - Received: "));
+  Serial.print(rxStats.bytesReceived);
+  Serial.print(F(", Dropped: "));
+  Serial.print(rxStats.bytesDropped);
+  Serial.print(F(", HW Overflows: "));
+  Serial.print(rxStats.hardwareOverflows);
+  Serial.print(F(", High Water: "));
+  Serial.println(rxStats.highWaterMark);
+
+  // Debug output: per-task worst-case runtimes
+  taskScheduler.printStats(Serial);
   #endif
   
-  snprintf(textScrollBuffer, sizeof(textScrollBuffer), "%s%d.%04d", GPS_LAT_PREFIX, latInt, latFrac);
+  formatFixedPoint(GPS_LAT_PREFIX, roundedQuotient(latE7, GPS_COORD_DISPLAY_DIVISOR), GPS_COORD_DECIMALS, GPS_NO_SUFFIX);
   scrollTextHorizontally(textScrollBuffer);
 
   // Display longitude using filtered value for stability (4 decimal places = ~11m accuracy)
-  float lng = gpsFilter.getFilteredLongitude();
-  int lngInt = (int)lng;
-  float lngDecimal = lng - lngInt;
-  int lngFrac = (int)(lngDecimal * GPS_COORD_PRECISION_MULTIPLIER);
+  int32_t lngE7 = gpsFilter.getFilteredLongitudeE7();
   
   #if ENABLE_SERIAL_DEBUG
-  // Debug output: show raw vs filtered values  
-  Serial.print("LON - Raw: ");
-  Serial.print(gpsModule.location.lng(), 6);
-  Serial.print(", Filtered: ");
-  Serial.println(lng, 6);
+  // Debug output: show raw vs filtered values (degrees x 10^7)
+  Serial.print(F("LON - Raw: "));
+  Serial.print(gpsModule.longitudeE7());
+  Serial.print(F(", Filtered: "));
+  Serial.println(lngE7);
   #endif
   
-  snprintf(textScrollBuffer, sizeof(textScrollBuffer), "%s%d.%04d", GPS_LON_PREFIX, lngInt, lngFrac);
+  formatFixedPoint(GPS_LON_PREFIX, roundedQuotient(lngE7, GPS_COORD_DISPLAY_DIVISOR), GPS_COORD_DECIMALS, GPS_NO_SUFFIX);
   scrollTextHorizontally(textScrollBuffer);
 
   // Display altitude using filtered value for stability if available
-  if (gpsModule.altitude.isValid()) {
-    // Use filtered altitude value and integer arithmetic since Arduino sprintf doesn't support floating-point
-    double altFeet = gpsFilter.getFilteredAltitude();
-    int altInt = (int)altFeet;
-    int altFrac = (int)((altFeet - altInt) * GPS_ALT_PRECISION_MULTIPLIER);
+  if (gpsModule.isAltitudeValid()) {
+    int32_t altCm = gpsFilter.getFilteredAltitudeCm();
     
     #if ENABLE_SERIAL_DEBUG
     // Debug output: show raw vs filtered altitude
-    Serial.print("ALT - Raw: ");
-    Serial.print(gpsModule.altitude.feet(), 2);
-    Serial.print("ft, Filtered: ");
-    Serial.print(altFeet, 2);
-    Serial.println("ft");
+    Serial.print(F("ALT - Raw: "));
+    Serial.print(gpsModule.altitudeCm());
+    Serial.print(F("cm, Filtered: "));
+    Serial.print(altCm);
+    Serial.println(F("cm"));
     #endif
     
-    snprintf(textScrollBuffer, sizeof(textScrollBuffer), "%s%d.%d%s", GPS_ALT_PREFIX, altInt, altFrac, GPS_ALT_SUFFIX);
+    // Centimeters to tenths of feet: cm / 3.048 = cm * 125 / 381
+    formatFixedPoint(GPS_ALT_PREFIX, roundedQuotient(altCm * 125, 381), GPS_ALT_DECIMALS, GPS_ALT_SUFFIX);
     scrollTextHorizontally(textScrollBuffer);
   }
 }
 
+/**
+ * @brief Divides a signed value, rounding half away from zero
+ * @param value Value to divide
+ * @param divisor Positive divisor
+ * @return Rounded quotient
+ */
+int32_t roundedQuotient(int32_t value, int32_t divisor) {
+  return value >= 0 ? (value + divisor / 2) / divisor : -((-value + divisor / 2) / divisor);
+}
+
+/**
+ * @brief Formats a fixed-point value into textScrollBuffer
+ * 
+ * The sign is printed separately so values between -1 and 0 keep their
+ * minus sign, and the fraction is zero-padded to the given number of digits.
+ * 
+ * @param prefix Text placed before the number (flash string)
+ * @param value Value in units of 10^-decimals (e.g. 123456 with 4 decimals = 12.3456)
+ * @param decimals Number of fractional digits in value
+ * @param suffix Text placed after the number (flash string)
+ */
+void formatFixedPoint(PGM_P prefix, int32_t value, uint8_t decimals, PGM_P suffix) {
+  uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < decimals; i++) {
+    scale *= 10;
+  }
+
+  snprintf_P(textScrollBuffer, sizeof(textScrollBuffer), PSTR("%S%s%lu.%0*lu%S"),
+           prefix, value < 0 ? "-" : "", (unsigned long)(magnitude / scale),
+           (int)decimals, (unsigned long)(magnitude % scale), suffix);
+}
+
 /**
  * @brief Detects power cycles and toggles time format if threshold is reached
  * 
@@ -542,27 +1283,73 @@ void displayGpsLocation() {
  * 12-hour and 24-hour time formats. The detection uses EEPROM to store cycle count.
  * 
  * The system works by incrementing a counter on each power cycle during startup.
- * If the counter reaches the threshold (5), it toggles the time format and resets 
- * the counter. The counter is reset after the welcome message to prevent accidental 
- * toggles during normal operation.
+ * If the counter reaches the threshold (5), it toggles the time format. The
+ * counter is reset by runPowerCycleTask() once the clock has run for
+ * POWER_CYCLE_WINDOW_MS, so only rapid power cycles count, independent of how
+ * long the boot sequence takes.
  * 
  * @note Called in setup() to detect power cycles for format switching
  * @note Uses EEPROM to persist cycle data across reboots
- * @note Counter resets after welcome message
  */
 void checkPowerCycles() {
-  // Read cycle count from EEPROM
-  unsigned long cycleCount = 0;
-  EEPROM.get(EEPROM_POWER_CYCLE_ADDR, cycleCount);
-  
-  // Increment cycle count
-  cycleCount++;
-  EEPROM.put(EEPROM_POWER_CYCLE_ADDR, cycleCount);
+  // Increment the saved cycle count; the record is written from the scheduler
+  uint8_t cycleCount = settingsStore.powerCycles();
+  if (cycleCount < 0xFF) cycleCount++;
+  settingsStore.setPowerCycles(cycleCount);
+  settingsStore.commit();
+  powerCycleCounted = true;
 
   // If threshold reached, toggle time format
   if (cycleCount > POWER_CYCLE_THRESHOLD) toggleTimeFormat();
 }
 
+/**
+ * @brief Scheduler task: clears the power cycle counter once the clock has
+ *        run for POWER_CYCLE_WINDOW_MS
+ * @return Always true
+ *
+ * First runs one window after the scheduler starts; later runs do nothing.
+ */
+bool runPowerCycleTask() {
+  if (powerCycleCounted) {
+    settingsStore.setPowerCycles(0);
+    settingsStore.commit();
+    powerCycleCounted = false;
+  }
+  return true;
+}
+
+/**
+ * @brief Scheduler task: writes the pending settings record to EEPROM
+ * 
+ * Starts at most one EEPROM byte write per run and returns while the
+ * previous one is still programming, so a record never stalls the loop.
+ * 
+ * @return true if an EEPROM byte write was started; idle runs are not
+ *         measured
+ */
+bool runSettingsWriteTask() {
+  return settingsStore.service();
+}
+
+/**
+ * @brief Scheduler task: saves the brightness and filtered position
+ * 
+ * Brightness changes and position moves beyond SETTINGS_POSITION_TOLERANCE_E7
+ * since the last save are batched into one record; without changes nothing
+ * is written.
+ * 
+ * @return Always true
+ */
+bool runSettingsSaveTask() {
+  if (gpsFilter.hasFilteredPosition()) {
+    settingsStore.setPosition(gpsFilter.getFilteredLatitudeE7(), gpsFilter.getFilteredLongitudeE7(),
+                              SETTINGS_POSITION_TOLERANCE_E7);
+  }
+  settingsStore.commit();
+  return true;
+}
+
 /**
  * @brief Toggles between 12-hour and 24-hour time format
  * 
@@ -574,18 +1361,187 @@ void checkPowerCycles() {
  * @note Shows confirmation message on display
  */
 void toggleTimeFormat() {
-  bool currentFormat = EEPROM.read(EEPROM_TIME_FORMAT_ADDR);
-  bool newFormat = !currentFormat;
+  bool newFormat = !settingsStore.is24Hour();
 
-  EEPROM.write(EEPROM_TIME_FORMAT_ADDR, newFormat);
+  settingsStore.set24Hour(newFormat);
+  settingsStore.commit();
 
   // Update cached format for immediate effect
   is24Hour = newFormat;
 
   // Show format change confirmation on display
   if (newFormat) {
-    scrollTextHorizontally(FORMAT_24H_MESSAGE);
+    scrollTextHorizontally(FPSTR(FORMAT_24H_MESSAGE));
   } else {
-    scrollTextHorizontally(FORMAT_12H_MESSAGE);
+    scrollTextHorizontally(FPSTR(FORMAT_12H_MESSAGE));
+  }
+}
+
+#if ENABLE_SERIAL_COMMANDS
+/**
+ * @brief Collects serial input lines and runs them as commands
+ * 
+ * Lines starting with '$' are NMEA sentences from the GPS module and are
+ * skipped, as are lines longer than SERIAL_COMMAND_LENGTH.
+ * 
+ * @param receivedChar Character received on the serial port
+ */
+void handleCommandByte(char receivedChar) {
+  if (receivedChar == '\r' || receivedChar == '\n') {
+    if (commandLength != COMMAND_IGNORED && commandLength > 0) {
+      commandBuffer[commandLength] = '\0';
+      runSerialCommand(commandBuffer);
+    }
+    commandLength = 0;
+    return;
+  }
+
+  if (commandLength == COMMAND_IGNORED) return;
+  if ((commandLength == 0 && receivedChar == '$') || commandLength >= SERIAL_COMMAND_LENGTH - 1) {
+    commandLength = COMMAND_IGNORED;
+    return;
   }
+  commandBuffer[commandLength++] = receivedChar;
+}
+
+/**
+ * @brief Runs one serial command line
+ * 
+ * "TZ" prints the selected zone, "TZ?" lists all zones and "TZ <name>"
+ * selects a zone, applies it from the next clock tick and saves it.
+ * 
+ * @param command Null-terminated command line
+ */
+void runSerialCommand(const char* command) {
+  if (strncasecmp_P(command, PSTR("TZ"), 2) != 0) return;
+  // Only "TZ" itself, not a longer word that starts with it
+  char separator = command[2];
+  if (separator != '\0' && separator != ' ' && separator != '=' && separator != '?') return;
+
+  const char* argument = command + 2;
+  while (*argument == ' ' || *argument == '=') argument++;
+
+  if (*argument == '?') {
+    if (argument[1] != '\0') return;
+    for (uint8_t i = 0; i < TimeZone::count(); i++) {
+      TimeZone::printName(i, Serial);
+      Serial.print(i + 1 < TimeZone::count() ? ' ' : '\n');
+    }
+    return;
+  }
+
+  if (*argument != '\0') {
+    uint8_t zone = TimeZone::find(argument);
+    if (zone == TimeZone::NOT_FOUND) {
+      Serial.println(F("TZ: unknown zone, TZ? lists them"));
+      return;
+    }
+
+    // Convert the last shown time back to UTC before switching, to show
+    // the new offset right away. Without a time the first clock tick fills
+    // the offset in.
+    if (validDisplayTime()) {
+      uint32_t utc = currentDateTime.unixtime() - timeZone.offset();
+      timeZone.select(zone);
+      timeZone.toLocal(utc);
+    } else {
+      timeZone.select(zone);
+    }
+
+    settingsStore.setTimeZone(zone);
+    settingsStore.commit();
+  }
+
+  printTimeZone();
+}
+
+/**
+ * @brief Prints the selected time zone and its current offset
+ * 
+ * Format: "TZ CET UTC+02:00 DST", or just "TZ CET" while there is no time
+ * to compute the offset for.
+ */
+void printTimeZone() {
+  if (!validDisplayTime()) {
+    Serial.print(F("TZ "));
+    TimeZone::printName(timeZone.selected(), Serial);
+    Serial.println();
+    return;
+  }
+
+  int32_t offsetMinutes = timeZone.offset() / 60;
+  char offsetText[8];
+  snprintf_P(offsetText, sizeof(offsetText), PSTR("%c%02d:%02d"),
+             offsetMinutes < 0 ? '-' : '+', (int)(labs(offsetMinutes) / 60), (int)(labs(offsetMinutes) % 60));
+
+  Serial.print(F("TZ "));
+  TimeZone::printName(timeZone.selected(), Serial);
+  Serial.print(F(" UTC"));
+  Serial.print(offsetText);
+  Serial.println(timeZone.isDst() ? F(" DST") : F(""));
+}
+#endif
+
+#if ENABLE_TELEMETRY
+/**
+ * @brief Scheduler task: sends the binary telemetry packets
+ * 
+ * Sends a status packet on every run. The position and health packets
+ * follow on different runs (offset within their intervals), so a single run
+ * never queues more than two packets into the serial transmit buffer.
+ * 
+ * @return Always true
+ */
+bool runTelemetryTask() {
+  uint8_t flags = 0;
+  if (validGpsDateTime()) flags |= TELEMETRY_FLAG_GPS_TIME;
+  if (gpsModule.isLocationValid()) flags |= TELEMETRY_FLAG_LOCATION;
+  if (gpsFilter.isMoving()) flags |= TELEMETRY_FLAG_MOVING;
+  if (timeZone.isDst()) flags |= TELEMETRY_FLAG_DST;
+  #if ENABLE_PPS_SYNC
+  if (ppsClock.isLocked()) flags |= TELEMETRY_FLAG_PPS_LOCKED;
+  #endif
+
+  #if ENABLE_RTC_HOLDOVER
+  uint8_t source = timeSource.getSource();
+  #else
+  uint8_t source = validGpsDateTime() ? TIME_SOURCE_GPS : TIME_SOURCE_NONE;
+  #endif
+
+  telemetry.begin(TELEMETRY_STATUS);
+  telemetry.add32(validDisplayTime() ? currentDateTime.unixtime() - timeZone.offset() : 0);
+  telemetry.add8(source);
+  telemetry.add8(flags);
+  telemetry.add16(timeZone.offset() / 60);
+  telemetry.add8(gpsFilter.getTotalReadings());
+  telemetry.add8(displayBrightness);
+  telemetry.add16(gpsModule.failedChecksums());
+  telemetry.send();
+
+  telemetryTicks++;
+
+  if (telemetryTicks % TELEMETRY_POSITION_EVERY == 0 && gpsFilter.hasFilteredPosition()) {
+    telemetry.begin(TELEMETRY_POSITION);
+    telemetry.add32(gpsModule.latitudeE7());
+    telemetry.add32(gpsModule.longitudeE7());
+    telemetry.add32(gpsFilter.getFilteredLatitudeE7());
+    telemetry.add32(gpsFilter.getFilteredLongitudeE7());
+    telemetry.add32(gpsFilter.getFilteredAltitudeCm());
+    telemetry.send();
+  } else if (telemetryTicks % TELEMETRY_HEALTH_EVERY == 1) {
+    GpsRxStats rxStats;
+    gpsRxBuffer.getStats(rxStats);
+
+    telemetry.begin(TELEMETRY_HEALTH);
+    telemetry.add32(millis());
+    telemetry.add32(rxStats.bytesReceived);
+    telemetry.add32(rxStats.bytesDropped);
+    telemetry.add16(rxStats.hardwareOverflows);
+    telemetry.add8(rxStats.highWaterMark);
+    telemetry.add16(taskScheduler.totalDeadlineMisses());
+    telemetry.send();
+  }
+
+  return true;
 }
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file Adafruit_GFX.cpp
+ * @brief Implementation of the host Adafruit_GFX replacement
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "Adafruit_GFX.h"
+
+// ============================================================================
+// FONT
+// ============================================================================
+
+/** Classic font glyphs of the time display, 5 columns each, bit 0 at the top */
+static const uint8_t DIGIT_GLYPHS[10][5] = {
+  { 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 0
+  { 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 1
+  { 0x72, 0x49, 0x49, 0x49, 0x46 },  // 2
+  { 0x21, 0x41, 0x49, 0x4D, 0x33 },  // 3
+  { 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 4
+  { 0x27, 0x45, 0x45, 0x45, 0x39 },  // 5
+  { 0x3C, 0x4A, 0x49, 0x49, 0x31 },  // 6
+  { 0x41, 0x21, 0x11, 0x09, 0x07 },  // 7
+  { 0x36, 0x49, 0x49, 0x49, 0x36 },  // 8
+  { 0x46, 0x49, 0x49, 0x29, 0x1E }   // 9
+};
+
+static const uint8_t COLON_GLYPH[5] = { 0x00, 0x00, 0x14, 0x00, 0x00 };
+static const uint8_t BLANK_GLYPH[5] = { 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/**
+ * @brief Glyph columns for a character
+ * @param c Character code
+ * @return Five column bytes; blank for characters without a glyph here
+ */
+static const uint8_t* glyphFor(unsigned char c) {
+  if (c >= '0' && c <= '9') return DIGIT_GLYPHS[c - '0'];
+  if (c == ':') return COLON_GLYPH;
+  return BLANK_GLYPH;
+}
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+  : WIDTH(w), HEIGHT(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+    textcolor(0xFFFF), textbgcolor(0xFFFF), textsize(1), rotation(0), wrap(true) {
+}
+
+// ============================================================================
+// PUBLIC METHODS
+// ============================================================================
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  for (int16_t x = 0; x < _width; x++) {
+    drawFastVLine(x, 0, _height, color);
+  }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  for (int16_t i = 0; i < h; i++) {
+    drawPixel(x, y + i, color);
+    mockCounters.gfxPixelWrites++;
+  }
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  _width = (rotation & 1) ? HEIGHT : WIDTH;
+  _height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  // Clip whole characters that are off the canvas, like the library does
+  if (x >= _width || y >= _height || (x + 6 * size - 1) < 0 || (y + 8 * size - 1) < 0) return;
+
+  const uint8_t* glyph = glyphFor(c);
+  for (int8_t i = 0; i < 5; i++) {
+    uint8_t line = glyph[i];
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if (line & 1) {
+        for (uint8_t s = 0; s < size; s++) drawFastVLine(x + i * size + s, y + j * size, size, color);
+      } else if (bg != color) {
+        for (uint8_t s = 0; s < size; s++) drawFastVLine(x + i * size + s, y + j * size, size, bg);
+      }
+    }
+  }
+
+  // Spacing column
+  if (bg != color) {
+    for (uint8_t s = 0; s < size; s++) drawFastVLine(x + 5 * size + s, y, 8 * size, bg);
+  }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += textsize * 8;
+  } else if (c != '\r') {
+    if (wrap && (cursor_x + textsize * 6) > _width) {
+      cursor_x = 0;
+      cursor_y += textsize * 8;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    cursor_x += textsize * 6;
+  }
+  return 1;
+}
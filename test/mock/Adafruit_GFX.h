@@ -0,0 +1,69 @@
+/**
+ * @file Adafruit_GFX.h
+ * @brief Host replacement for the parts of Adafruit_GFX the clock uses
+ *
+ * Same class layout and drawing order as the real library for the classic
+ * 5x7 font: drawChar() visits the glyph column by column and calls
+ * drawPixel() for every lit pixel (and every background pixel plus the
+ * spacing column when the background differs from the text color). Only the
+ * glyphs of the time display (digits, ':' and space) carry real pixels;
+ * other characters draw as blank cells. Every pixel drawn is counted in
+ * mockCounters.gfxPixelWrites.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef MOCK_ADAFRUIT_GFX_H
+#define MOCK_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+/**
+ * @class Adafruit_GFX
+ * @brief Drawing base class: rotation, text cursor and the classic font
+ */
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  /** Draw one pixel, implemented by the display driver */
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void fillScreen(uint16_t color);
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void setRotation(uint8_t r);
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+
+  /** Print text at the cursor with drawChar() */
+  size_t write(uint8_t c);
+  using Print::write;
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+  void setTextSize(uint8_t s) { textsize = s ? s : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  uint8_t getRotation() const { return rotation; }
+
+protected:
+  const int16_t WIDTH;
+  const int16_t HEIGHT;
+  int16_t _width;
+  int16_t _height;
+  int16_t cursor_x;
+  int16_t cursor_y;
+  uint16_t textcolor;
+  uint16_t textbgcolor;
+  uint8_t textsize;
+  uint8_t rotation;
+  bool wrap;
+};
+
+#endif // MOCK_ADAFRUIT_GFX_H
@@ -0,0 +1,102 @@
+/**
+ * @file Arduino.cpp
+ * @brief Implementation of the host Arduino core replacement
+ *
+ * This file contains the simulated clock, the operation counters and the
+ * Print helpers of the native test build.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "Arduino.h"
+
+// ============================================================================
+// MOCK STATE
+// ============================================================================
+
+MockCounters mockCounters;
+HardwareSerial Serial;
+
+/** Simulated time in microseconds */
+static unsigned long currentMicros = 0;
+
+/** State of the random number generator */
+static uint32_t randomState = 1;
+
+// ============================================================================
+// MOCK CONTROL
+// ============================================================================
+
+void mockResetCounters() {
+  memset(&mockCounters, 0, sizeof(mockCounters));
+}
+
+void mockSetMillis(unsigned long ms) {
+  currentMicros = ms * 1000UL;
+}
+
+void mockAdvanceMillis(unsigned long ms) {
+  currentMicros += ms * 1000UL;
+}
+
+// ============================================================================
+// ARDUINO FUNCTIONS
+// ============================================================================
+
+unsigned long millis() { return currentMicros / 1000UL; }
+unsigned long micros() { return currentMicros; }
+void delay(unsigned long ms) { mockAdvanceMillis(ms); }
+void delayMicroseconds(unsigned int us) { currentMicros += us; }
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t value) { (void)pin; (void)value; mockCounters.digitalWrites++; }
+int digitalRead(uint8_t pin) { (void)pin; return LOW; }
+int analogRead(uint8_t pin) { (void)pin; return 0; }
+
+/**
+ * @brief Next pseudo random number (31 bit linear congruential generator)
+ *
+ * Only needs to be repeatable, not good: the rain effect uses it for drop
+ * positions and speeds.
+ */
+static uint32_t nextRandom() {
+  randomState = randomState * 1103515245UL + 12345UL;
+  return (randomState >> 1) & 0x7FFFFFFFUL;
+}
+
+long random(long howBig) {
+  return howBig > 0 ? (long)(nextRandom() % (uint32_t)howBig) : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  randomState = seed ? (uint32_t)seed : 1;
+}
+
+// ============================================================================
+// PRINT
+// ============================================================================
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t written = 0;
+  while (size--) written += write(*buffer++);
+  return written;
+}
+
+size_t Print::print(long value) {
+  char text[12];
+  snprintf(text, sizeof(text), "%ld", value);
+  return write(text);
+}
+
+size_t Print::print(unsigned long value) {
+  char text[12];
+  snprintf(text, sizeof(text), "%lu", value);
+  return write(text);
+}
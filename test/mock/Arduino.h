@@ -0,0 +1,193 @@
+/**
+ * @file Arduino.h
+ * @brief Host replacement for the Arduino core used by the native test build
+ *
+ * This file provides the subset of the Arduino API that the clock modules
+ * under test use, so they compile unchanged with the host compiler
+ * (env:native). Time does not pass on its own: tests move millis() and
+ * micros() forward with mockAdvanceMillis(), which makes every run
+ * repeatable. Pin and SPI traffic is counted in mockCounters.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <math.h>
+
+#ifndef ARDUINO
+#define ARDUINO 100
+#endif
+
+// ============================================================================
+// TYPES AND CONSTANTS
+// ============================================================================
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH                0x1
+#define LOW                 0x0
+#define INPUT               0x0
+#define OUTPUT              0x1
+#define INPUT_PULLUP        0x2
+
+#define PI                  3.1415926535897932384626433832795
+#define HALF_PI             1.5707963267948966192313216916398
+#define TWO_PI              6.283185307179586476925286766559
+#define DEG_TO_RAD          0.017453292519943295769236907684886
+#define RAD_TO_DEG          57.295779513082320876798154814105
+
+#define radians(deg)        ((deg) * DEG_TO_RAD)
+#define degrees(rad)        ((rad) * RAD_TO_DEG)
+#define sq(x)               ((x) * (x))
+
+#ifndef min
+#define min(a, b)           ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b)           ((a) > (b) ? (a) : (b))
+#endif
+#define constrain(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+
+// Flash access: everything lives in RAM on the host
+#define PROGMEM
+#define PSTR(s)             (s)
+#define F(s)                (reinterpret_cast<const __FlashStringHelper*>(s))
+#define pgm_read_byte(p)    (*(const uint8_t*)(p))
+#define pgm_read_word(p)    (*(const uint16_t*)(p))
+#define pgm_read_dword(p)   (*(const uint32_t*)(p))
+#define strlen_P            strlen
+#define strcpy_P            strcpy
+#define strncasecmp_P       strncasecmp
+#define snprintf_P          snprintf
+
+// No interrupts on the host, the tests are single threaded
+#define noInterrupts()
+#define interrupts()
+
+class __FlashStringHelper;
+
+// ============================================================================
+// MOCK CONTROL
+// ============================================================================
+
+/**
+ * @struct MockCounters
+ * @brief Hardware operations performed since the last mockResetCounters()
+ */
+struct MockCounters {
+  unsigned long digitalWrites;   /**< digitalWrite() calls (e.g. SPI chip select) */
+  unsigned long spiTransfers;    /**< Bytes shifted out with SPI.transfer() */
+  unsigned long gfxPixelWrites;  /**< Pixels Adafruit_GFX drew through drawPixel() */
+};
+
+/** Operation counters, read by the tests */
+extern MockCounters mockCounters;
+
+/**
+ * @brief Clear all operation counters
+ */
+void mockResetCounters();
+
+/**
+ * @brief Set the time returned by millis() (micros() follows)
+ * @param ms New time in milliseconds
+ */
+void mockSetMillis(unsigned long ms);
+
+/**
+ * @brief Move millis() and micros() forward
+ * @param ms Milliseconds to add
+ */
+void mockAdvanceMillis(unsigned long ms);
+
+// ============================================================================
+// ARDUINO FUNCTIONS
+// ============================================================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+/**
+ * @brief Deterministic pseudo random numbers (same sequence on every run)
+ */
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// ============================================================================
+// PRINT AND STREAM
+// ============================================================================
+
+/**
+ * @class Print
+ * @brief Minimal Arduino Print: text and decimal numbers through write()
+ */
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t value) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+  size_t print(const char* text) { return write(text); }
+  size_t print(const __FlashStringHelper* text) { return print(reinterpret_cast<const char*>(text)); }
+  size_t print(char value) { return write((uint8_t)value); }
+  size_t print(int value) { return print((long)value); }
+  size_t print(unsigned int value) { return print((unsigned long)value); }
+  size_t print(long value);
+  size_t print(unsigned long value);
+
+  size_t println() { return write("\r\n"); }
+  template<typename T> size_t println(T value) { return print(value) + println(); }
+};
+
+/**
+ * @class Stream
+ * @brief Arduino Stream interface (input side)
+ */
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+/** Receive buffer size of the AVR core's HardwareSerial */
+#define SERIAL_RX_BUFFER_SIZE 64
+
+/**
+ * @class HardwareSerial
+ * @brief Serial port stand-in: output goes to stdout, there is no input
+ */
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  int available() { return 0; }
+  int read() { return -1; }
+  int peek() { return -1; }
+  size_t write(uint8_t value) { return fputc(value, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif // MOCK_ARDUINO_H
@@ -0,0 +1,13 @@
+/**
+ * @file SPI.cpp
+ * @brief SPI bus instance of the native test build
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "SPI.h"
+
+SPIClass SPI;
@@ -0,0 +1,32 @@
+/**
+ * @file SPI.h
+ * @brief Host replacement for the Arduino SPI library
+ *
+ * Transfers go nowhere; each byte is counted in mockCounters.spiTransfers so
+ * the tests can check how much display traffic an operation causes.
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef MOCK_SPI_H
+#define MOCK_SPI_H
+
+#include <Arduino.h>
+
+/**
+ * @class SPIClass
+ * @brief Counting SPI bus stand-in
+ */
+class SPIClass {
+public:
+  void begin() {}
+  void end() {}
+  uint8_t transfer(uint8_t data) { (void)data; mockCounters.spiTransfers++; return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif // MOCK_SPI_H
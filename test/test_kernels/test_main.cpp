@@ -0,0 +1,298 @@
+/**
+ * @file test_main.cpp
+ * @brief Op-count benchmarks of the rendering and filtering kernels (host)
+ *
+ * Runs the display and filter code on the host against the mocks in
+ * test/mock, with the panel laid out as in configureLedMatrix() (4 modules,
+ * rotated 90 degrees). Each test checks the hardware work an operation
+ * causes (SPI bytes, chip select toggles, pixels drawn), so a change that
+ * makes a kernel do more work fails here without flashing a board. The
+ * report lines also give an AVR cycle estimate of the bus traffic and the
+ * host time per operation, which is only useful for comparing runs on the
+ * same machine.
+ *
+ * Run with: pio test -e native -f test_kernels -v
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include <chrono>
+#include <unity.h>
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Max72xxPanel.h>
+#include "GpsReceiver.h"
+#include "GpsStabilityFilter.h"
+#include "RainEffect.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** Display wiring of the clock (config.h) */
+static const uint8_t MATRIX_CS_PIN = 10;
+static const uint8_t MATRIX_MODULES = 4;
+static const uint8_t MATRIX_ROTATION = 1;
+
+/** Same frame cap as the firmware (RAIN_MAX_FPS in config.h) */
+static const uint8_t RAIN_MAX_FPS = 30;
+
+/**
+ * AVR cost estimates at 16 MHz: SPI.transfer() at the default SPI_CLOCK_DIV4
+ * is 32 cycles of shifting plus the status poll, digitalWrite() is about 56
+ * cycles with the pin lookup
+ */
+static const unsigned long AVR_CYCLES_PER_SPI_BYTE = 40;
+static const unsigned long AVR_CYCLES_PER_DIGITAL_WRITE = 56;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+typedef std::chrono::steady_clock HostClock;
+
+/**
+ * @brief Build the panel like setup() and configureLedMatrix() do
+ *
+ * The constructor already sends the init commands; counters are reset
+ * afterwards so the tests only see their own traffic.
+ */
+static Max72xxPanel* createPanel() {
+  Max72xxPanel* panel = new Max72xxPanel(MATRIX_CS_PIN, MATRIX_MODULES, 1);
+  for (uint8_t module = 0; module < MATRIX_MODULES; module++) {
+    panel->setPosition(module, module, 0);
+    panel->setRotation(module, MATRIX_ROTATION);
+  }
+  panel->fillScreen(LOW);
+  panel->write();
+  mockResetCounters();
+  return panel;
+}
+
+/**
+ * @brief Print one result line: ops, hardware work per op and host time
+ * @param name Kernel name
+ * @param ops Number of operations measured
+ * @param start Host time before the first operation
+ */
+static void report(const char* name, unsigned long ops, HostClock::time_point start) {
+  double hostNs = std::chrono::duration<double, std::nano>(HostClock::now() - start).count();
+  unsigned long busCycles = mockCounters.spiTransfers * AVR_CYCLES_PER_SPI_BYTE +
+                            mockCounters.digitalWrites * AVR_CYCLES_PER_DIGITAL_WRITE;
+
+  char line[160];
+  snprintf(line, sizeof(line),
+           "BENCH %-12s ops:%-5lu spi:%lu cs:%lu px:%lu bus~%lu cycles/op host:%.1f ns/op",
+           name, ops, mockCounters.spiTransfers, mockCounters.digitalWrites,
+           mockCounters.gfxPixelWrites, busCycles / ops, hostNs / ops);
+  TEST_MESSAGE(line);
+}
+
+// ============================================================================
+// MAX72XXPANEL
+// ============================================================================
+
+void test_draw_pixel_only_touches_the_buffer() {
+  Max72xxPanel* panel = createPanel();
+  int16_t width = panel->width();
+  int16_t height = panel->height();
+  unsigned long ops = 0;
+
+  HostClock::time_point start = HostClock::now();
+  for (uint8_t color = 0; color < 2; color++) {
+    for (int16_t y = 0; y < height; y++) {
+      for (int16_t x = 0; x < width; x++, ops++) {
+        panel->drawPixel(x, y, color ? LOW : HIGH);
+      }
+    }
+  }
+  report("drawPixel", ops, start);
+
+  TEST_ASSERT_EQUAL_UINT32(2UL * 32 * 8, ops);
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.spiTransfers);
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.digitalWrites);
+  delete panel;
+}
+
+void test_write_sends_only_changed_rows() {
+  Max72xxPanel* panel = createPanel();
+
+  // Nothing changed: no bus traffic at all
+  panel->write();
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.spiTransfers);
+
+  // One pixel: one digit row, opcode + data for each of the 4 modules
+  const unsigned long ops = 64;
+  HostClock::time_point start = HostClock::now();
+  for (unsigned long i = 0; i < ops; i++) {
+    panel->drawPixel(0, 0, (i & 1) ? LOW : HIGH);
+    panel->write();
+  }
+  report("write 1 row", ops, start);
+
+  TEST_ASSERT_EQUAL_UINT32(ops * 2 * MATRIX_MODULES, mockCounters.spiTransfers);
+  TEST_ASSERT_EQUAL_UINT32(ops * 2, mockCounters.digitalWrites);
+  delete panel;
+}
+
+void test_force_full_write_sends_every_row() {
+  Max72xxPanel* panel = createPanel();
+
+  const unsigned long ops = 64;
+  HostClock::time_point start = HostClock::now();
+  for (unsigned long i = 0; i < ops; i++) {
+    panel->forceFullWrite();
+  }
+  report("write full", ops, start);
+
+  TEST_ASSERT_EQUAL_UINT32(ops * 8 * 2 * MATRIX_MODULES, mockCounters.spiTransfers);
+  TEST_ASSERT_EQUAL_UINT32(ops * 8 * 2, mockCounters.digitalWrites);
+  delete panel;
+}
+
+// ============================================================================
+// GLYPH DRAWING
+// ============================================================================
+
+void test_draw_char_visits_each_cell_pixel_once() {
+  Max72xxPanel* panel = createPanel();
+
+  // Time display call: opaque background, so all 6x8 pixels are drawn
+  const unsigned long ops = 100;
+  HostClock::time_point start = HostClock::now();
+  for (unsigned long i = 0; i < ops; i++) {
+    panel->drawChar((i % 5) * 6, 0, '0' + (i % 10), HIGH, LOW, 1);
+  }
+  report("drawChar", ops, start);
+
+  TEST_ASSERT_EQUAL_UINT32(ops * 6 * 8, mockCounters.gfxPixelWrites);
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.spiTransfers);
+
+  // Fully off the canvas (slide animation start): clipped before drawing
+  mockResetCounters();
+  panel->drawChar(0, -8, '8', HIGH, LOW, 1);
+  panel->drawChar(panel->width(), 0, '8', HIGH, LOW, 1);
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.gfxPixelWrites);
+  delete panel;
+}
+
+// ============================================================================
+// RAIN EFFECT
+// ============================================================================
+
+void test_rain_frames_respect_the_frame_cap() {
+  Max72xxPanel* panel = createPanel();
+  RainEffect rain(*panel, RAIN_MAX_FPS);
+  randomSeed(1);
+  mockSetMillis(0);
+  rain.initialize();
+
+  // Ten seconds at one loop per millisecond
+  const unsigned long loops = 10000;
+  unsigned long frames = 0;
+  HostClock::time_point start = HostClock::now();
+  for (unsigned long i = 0; i < loops; i++) {
+    mockAdvanceMillis(1);
+    unsigned long before = mockCounters.spiTransfers;
+    if (rain.update()) rain.render();
+    if (mockCounters.spiTransfers != before) frames++;
+  }
+  report("rain loop", loops, start);
+
+  char line[80];
+  snprintf(line, sizeof(line), "rain: %lu frames written in %lu ms", frames, loops);
+  TEST_MESSAGE(line);
+
+  // Frames are written, but never more often than the cap allows, and a
+  // frame never costs more than a full write
+  TEST_ASSERT_TRUE(frames > 0);
+  TEST_ASSERT_TRUE(frames <= loops * RAIN_MAX_FPS / 1000 + 1);
+  TEST_ASSERT_TRUE(mockCounters.spiTransfers <= frames * 8 * 2 * MATRIX_MODULES);
+  delete panel;
+}
+
+void test_rain_render_without_change_does_nothing() {
+  Max72xxPanel* panel = createPanel();
+  RainEffect rain(*panel, RAIN_MAX_FPS);
+  mockSetMillis(0);
+  rain.initialize();
+  rain.render();
+  mockResetCounters();
+
+  // Same millisecond: nothing can have moved
+  for (uint8_t i = 0; i < 100; i++) {
+    rain.render();
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.spiTransfers);
+  TEST_ASSERT_EQUAL_UINT32(0, mockCounters.digitalWrites);
+  delete panel;
+}
+
+// ============================================================================
+// GPS STABILITY FILTER
+// ============================================================================
+
+/**
+ * @brief Feed one NMEA sentence to the receiver
+ * @param gps Receiver
+ * @param sentence Complete sentence including "\r\n"
+ */
+static void feed(GpsReceiver& gps, const char* sentence) {
+  while (*sentence) gps.encode(*sentence++);
+}
+
+void test_filter_getters_return_cached_values() {
+  GpsReceiver gps;
+  GpsStabilityFilter filter(gps);
+  mockSetMillis(0);
+
+  for (uint8_t i = 0; i < 12; i++) {
+    mockAdvanceMillis(1000);
+    feed(gps, "$GPRMC,120000.00,A,1723.10260,N,07829.20026,E,0.010,,141026,,,A*72\r\n");
+    feed(gps, "$GPGGA,120000.00,1723.10260,N,07829.20026,E,1,08,0.94,542.3,M,-73.5,M,,*76\r\n");
+    filter.update();
+  }
+  TEST_ASSERT_TRUE(filter.hasFilteredPosition());
+
+  const unsigned long ops = 100000;
+  int32_t last = 0;
+  HostClock::time_point start = HostClock::now();
+  for (unsigned long i = 0; i < ops; i++) {
+    last ^= filter.getFilteredLatitudeE7();
+    last ^= filter.getFilteredLongitudeE7();
+    last ^= filter.getFilteredAltitudeCm();
+  }
+  report("filter get", ops, start);
+
+  TEST_ASSERT_EQUAL_INT32(173850433L, filter.getFilteredLatitudeE7());
+  TEST_ASSERT_EQUAL_INT32(784866710L, filter.getFilteredLongitudeE7());
+  TEST_ASSERT_EQUAL_INT32(54230, filter.getFilteredAltitudeCm());
+  // An even number of XORs of the same values cancels out
+  TEST_ASSERT_EQUAL_INT32(0, last);
+}
+
+// ============================================================================
+// TEST RUNNER
+// ============================================================================
+
+void setUp() {
+  mockResetCounters();
+}
+
+void tearDown() {
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_draw_pixel_only_touches_the_buffer);
+  RUN_TEST(test_write_sends_only_changed_rows);
+  RUN_TEST(test_force_full_write_sends_every_row);
+  RUN_TEST(test_draw_char_visits_each_cell_pixel_once);
+  RUN_TEST(test_rain_frames_respect_the_frame_cap);
+  RUN_TEST(test_rain_render_without_change_does_nothing);
+  RUN_TEST(test_filter_getters_return_cached_values);
+  return UNITY_END();
+}
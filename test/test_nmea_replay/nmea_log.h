@@ -0,0 +1,638 @@
+/**
+ * @file nmea_log.h
+ * @brief NMEA log replayed by the parse throughput test
+ *
+ * Synthetic u-blox style log at 1 Hz: cold start, time before fix, 68 s of
+ * stationary 3D fix across midnight UTC, and one RMC sentence damaged in
+ * transit.
+ * Generated by tools/nmea_fixture.py (616 sentences, 34298 bytes).
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef NMEA_LOG_H
+#define NMEA_LOG_H
+
+static const char NMEA_LOG[] =
+  "$GPRMC,,V,,,,,,,,,,N*53\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,00*79\r\n"
+  "$GPGLL,,,,,,V,N*64\r\n"
+  "$GPRMC,,V,,,,,,,,,,N*53\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,00*79\r\n"
+  "$GPGLL,,,,,,V,N*64\r\n"
+  "$GPRMC,,V,,,,,,,,,,N*53\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,00*79\r\n"
+  "$GPGLL,,,,,,V,N*64\r\n"
+  "$GPRMC,,V,,,,,,,,,,N*53\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,00*79\r\n"
+  "$GPGLL,,,,,,V,N*64\r\n"
+  "$GPRMC,,V,,,,,,,,,,N*53\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,00*79\r\n"
+  "$GPGLL,,,,,,V,N*64\r\n"
+  "$GPRMC,235855.00,V,,,,,,141026,,,N*5D\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235855.00,,,,,0,03,,,,,,,*47\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235855.00,V,N*46\r\n"
+  "$GPRMC,235856.00,V,,,,,,141026,,,N*5E\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235856.00,,,,,0,03,,,,,,,*44\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235856.00,V,N*45\r\n"
+  "$GPRMC,235857.00,V,,,,,,141026,,,N*5F\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235857.00,,,,,0,03,,,,,,,*45\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235857.00,V,N*44\r\n"
+  "$GPRMC,235858.00,V,,,,,,141026,,,N*50\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235858.00,,,,,0,03,,,,,,,*4A\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235858.00,V,N*4B\r\n"
+  "$GPRMC,235859.00,V,,,,,,141026,,,N*51\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235859.00,,,,,0,03,,,,,,,*4B\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235859.00,V,N*4A\r\n"
+  "$GPRMC,235900.00,V,,,,,,141026,,,N*5C\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235900.00,,,,,0,03,,,,,,,*46\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235900.00,V,N*47\r\n"
+  "$GPRMC,235901.00,V,,,,,,141026,,,N*5D\r\n"
+  "$GPVTG,,,,,,,,,N*30\r\n"
+  "$GPGGA,235901.00,,,,,0,03,,,,,,,*47\r\n"
+  "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+  "$GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30*45\r\n"
+  "$GPGLL,,,,,235901.00,V,N*46\r\n"
+  "$GPRMC,235902.00,A,1723.10252,N,07829.20051,E,0.137,,141026,,,A*7B\r\n"
+  "$GPVTG,,T,,M,0.012,N,0.046,K,A*22\r\n"
+  "$GPGGA,235902.00,1723.10252,N,07829.20051,E,1,08,0.94,542.1,M,-73.5,M,,*79\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10252,N,07829.20051,E,235902.00,A,A*67\r\n"
+  "$GPRMC,235903.00,A,1723.10249,N,07829.19935,E,0.054,,141026,,,A*75\r\n"
+  "$GPVTG,,T,,M,0.004,N,0.011,K,A*27\r\n"
+  "$GPGGA,235903.00,1723.10249,N,07829.19935,E,1,08,0.94,541.4,M,-73.5,M,,*75\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10249,N,07829.19935,E,235903.00,A,A*6D\r\n"
+  "$GPRMC,235904.00,A,1723.10247,N,07829.20033,E,0.144,,141026,,,A*79\r\n"
+  "$GPVTG,,T,,M,0.015,N,0.028,K,A*2D\r\n"
+  "$GPGGA,235904.00,1723.10247,N,07829.20033,E,1,08,0.94,543.0,M,-73.5,M,,*7F\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10247,N,07829.20033,E,235904.00,A,A*61\r\n"
+  "$GPRMC,235905.00,A,1723.10291,N,07829.19983,E,0.015,,141026,,,A*7E\r\n"
+  "$GPVTG,,T,,M,0.073,N,0.074,K,A*24\r\n"
+  "$GPGGA,235905.00,1723.10291,N,07829.19983,E,1,08,0.94,541.5,M,-73.5,M,,*7A\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10291,N,07829.19983,E,235905.00,A,A*63\r\n"
+  "$GPRMC,235906.00,A,1723.10159,N,07829.20105,E,0.074,,141026,,,A*71\r\n"
+  "$GPVTG,,T,,M,0.053,N,0.018,K,A*2C\r\n"
+  "$GPGGA,235906.00,1723.10159,N,07829.20105,E,1,08,0.94,543.8,M,-73.5,M,,*7D\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10159,N,07829.20105,E,235906.00,A,A*6B\r\n"
+  "$GPRMC,235907.00,A,1723.10291,N,07829.19966,E,0.143,,141026,,,A*75\r\n"
+  "$GPVTG,,T,,M,0.087,N,0.023,K,A*2D\r\n"
+  "$GPGGA,235907.00,1723.10291,N,07829.19966,E,1,08,0.94,542.0,M,-73.5,M,,*75\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10291,N,07829.19966,E,235907.00,A,A*6A\r\n"
+  "$GPRMC,235908.00,A,1723.10314,N,07829.20064,E,0.016,,141026,,,A*76\r\n"
+  "$GPVTG,,T,,M,0.072,N,0.007,K,A*21\r\n"
+  "$GPGGA,235908.00,1723.10314,N,07829.20064,E,1,08,0.94,542.4,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10314,N,07829.20064,E,235908.00,A,A*68\r\n"
+  "$GPRMC,235909.00,A,1723.10284,N,07829.19985,E,0.136,,141026,,,A*70\r\n"
+  "$GPVTG,,T,,M,0.054,N,0.099,K,A*22\r\n"
+  "$GPGGA,235909.00,1723.10284,N,07829.19985,E,1,08,0.94,541.7,M,-73.5,M,,*76\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10284,N,07829.19985,E,235909.00,A,A*6D\r\n"
+  "$GPRMC,235910.00,A,1723.10239,N,07829.20085,E,0.046,,141026,,,A*7B\r\n"
+  "$GPVTG,,T,,M,0.089,N,0.099,K,A*22\r\n"
+  "$GPGGA,235910.00,1723.10239,N,07829.20085,E,1,08,0.94,541.7,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10239,N,07829.20085,E,235910.00,A,A*60\r\n"
+  "$GPRMC,235911.00,A,1723.10276,N,07829.20028,E,0.134,,141026,,,A*72\r\n"
+  "$GPVTG,,T,,M,0.063,N,0.043,K,A*21\r\n"
+  "$GPGGA,235911.00,1723.10276,N,07829.20028,E,1,08,0.94,543.3,M,-73.5,M,,*70\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10276,N,07829.20028,E,235911.00,A,A*6D\r\n"
+  "$GPRMC,235912.00,A,1723.10259,N,07829.19987,E,0.107,,141026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.021,N,0.096,K,A*2F\r\n"
+  "$GPGGA,235912.00,1723.10259,N,07829.19987,E,1,08,0.94,542.7,M,-73.5,M,,*7D\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10259,N,07829.19987,E,235912.00,A,A*65\r\n"
+  "$GPRMC,235913.00,A,1723.10261,N,07829.19965,E,0.107,,141026,,,A*7C\r\n"
+  "$GPVTG,,T,,M,0.005,N,0.085,K,A*2B\r\n"
+  "$GPGGA,235913.00,1723.10261,N,07829.19965,E,1,08,0.94,543.9,M,-73.5,M,,*74\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10261,N,07829.19965,E,235913.00,A,A*63\r\n"
+  "$GPRMC,235914.00,A,1723.10318,N,07829.20055,E,0.087,,141026,,,A*7D\r\n"
+  "$GPVTG,,T,,M,0.088,N,0.044,K,A*23\r\n"
+  "$GPGGA,235914.00,1723.10318,N,07829.20055,E,1,08,0.94,542.7,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10318,N,07829.20055,E,235914.00,A,A*6B\r\n"
+  "$GPRMC,235915.00,A,1723.10178,N,07829.19974,E,0.116,,141026,,,A*71\r\n"
+  "$GPVTG,,T,,M,0.008,N,0.011,K,A*2B\r\n"
+  "$GPGGA,235915.00,1723.10178,N,07829.19974,E,1,08,0.94,541.7,M,-73.5,M,,*75\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10178,N,07829.19974,E,235915.00,A,A*6E\r\n"
+  "$GPRMC,235916.00,A,1723.10315,N,07829.20007,E,0.079,,141026,,,A*74\r\n"
+  "$GPVTG,,T,,M,0.082,N,0.073,K,A*2D\r\n"
+  "$GPGGA,235916.00,1723.10315,N,07829.20007,E,1,08,0.94,542.2,M,-73.5,M,,*7E\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10315,N,07829.20007,E,235916.00,A,A*63\r\n"
+  "$GPRMC,235917.00,A,1723.10249,N,07829.20115,E,0.072,,141026,,,A*74\r\n"
+  "$GPVTG,,T,,M,0.091,N,0.049,K,A*26\r\n"
+  "$GPGGA,235917.00,1723.10249,N,07829.20115,E,1,08,0.94,542.2,M,-73.5,M,,*75\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10249,N,07829.20115,E,235917.00,A,A*68\r\n"
+  "$GPRMC,235918.00,A,1723.10298,N,07829.19997,E,0.029,,141026,,,A*71\r\n"
+  "$GPVTG,,T,,M,0.063,N,0.007,K,A*21\r\n"
+  "$GPGGA,235918.00,1723.10298,N,07829.19997,E,1,08,0.94,543.0,M,-73.5,M,,*7D\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10298,N,07829.19997,E,235918.00,A,A*63\r\n"
+  "$GPRMC,235919.00,A,1723.10248,N,07829.20034,E,0.063,,141026,,,A*79\r\n"
+  "$GPVTG,,T,,M,0.050,N,0.050,K,A*23\r\n"
+  "$GPGGA,235919.00,1723.10248,N,07829.20034,E,1,08,0.94,542.9,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10248,N,07829.20034,E,235919.00,A,A*65\r\n"
+  "$GPRMC,235920.00,A,1723.10313,N,07829.19998,E,0.071,,141026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.017,N,0.055,K,A*25\r\n"
+  "$GPGGA,235920.00,1723.10313,N,07829.19998,E,1,08,0.94,542.7,M,-73.5,M,,*7D\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10313,N,07829.19998,E,235920.00,A,A*65\r\n"
+  "$GPRMC,235921.00,A,1723.10306,N,07829.20051,E,0.106,,141026,,,A*78\r\n"
+  "$GPVTG,,T,,M,0.045,N,0.087,K,A*2D\r\n"
+  "$GPGGA,235921.00,1723.10306,N,07829.20051,E,1,08,0.94,541.8,M,-73.5,M,,*72\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10306,N,07829.20051,E,235921.00,A,A*66\r\n"
+  "$GPRMC,235922.00,A,1723.10354,N,07829.19946,E,0.059,,141026,,,A*72\r\n"
+  "$GPVTG,,T,,M,0.084,N,0.029,K,A*24\r\n"
+  "$GPGGA,235922.00,1723.10354,N,07829.19946,E,1,08,0.94,542.6,M,-73.5,M,,*7E\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10354,N,07829.19946,E,235922.00,A,A*67\r\n"
+  "$GPRMC,235923.00,A,1723.10288,N,07829.20116,E,0.046,,141026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.033,N,0.036,K,A*26\r\n"
+  "$GPGGA,235923.00,1723.10288,N,07829.20116,E,1,08,0.94,542.4,M,-73.5,M,,*7A\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10288,N,07829.20116,E,235923.00,A,A*61\r\n"
+  "$GPRMC,235924.00,A,1723.10314,N,07829.20027,E,0.032,,141026,,,A*79\r\n"
+  "$GPVTG,,T,,M,0.088,N,0.065,K,A*20\r\n"
+  "$GPGGA,235924.00,1723.10314,N,07829.20027,E,1,08,0.94,541.6,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10314,N,07829.20027,E,235924.00,A,A*61\r\n"
+  "$GPRMC,235925.00,A,1723.10309,N,07829.20093,E,0.013,,141026,,,A*78\r\n"
+  "$GPVTG,,T,,M,0.058,N,0.099,K,A*2E\r\n"
+  "$GPGGA,235925.00,1723.10309,N,07829.20093,E,1,08,0.94,541.9,M,-73.5,M,,*76\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10309,N,07829.20093,E,235925.00,A,A*63\r\n"
+  "$GPRMC,235926.00,A,1723.10333,N,07829.20004,E,0.100,,141026,,,A*7F\r\n"
+  "$GPVTG,,T,,M,0.013,N,0.061,K,A*26\r\n"
+  "$GPGGA,235926.00,1723.10333,N,07829.20004,E,1,08,0.94,541.5,M,-73.5,M,,*7E\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10333,N,07829.20004,E,235926.00,A,A*67\r\n"
+  "$GPRMC,235927.00,A,1723.10246,N,07829.20015,E,0.017,,141026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.026,N,0.056,K,A*24\r\n"
+  "$GPGGA,235927.00,1723.10246,N,07829.20015,E,1,08,0.94,542.1,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10246,N,07829.20015,E,235927.00,A,A*65\r\n"
+  "$GPRMC,235928.00,A,1723.10287,N,07829.20063,E,0.038,,141026,,,A*74\r\n"
+  "$GPVTG,,T,,M,0.068,N,0.012,K,A*2E\r\n"
+  "$GPGGA,235928.00,1723.10287,N,07829.20063,E,1,08,0.94,542.3,M,-73.5,M,,*7A\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10287,N,07829.20063,E,235928.00,A,A*66\r\n"
+  "$GPRMC,235929.00,A,1723.10264,N,07829.20089,E,0.018,,141026,,,A*7E\r\n"
+  "$GPVTG,,T,,M,0.026,N,0.078,K,A*28\r\n"
+  "$GPGGA,235929.00,1723.10264,N,07829.20089,E,1,08,0.94,542.0,M,-73.5,M,,*71\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10264,N,07829.20089,E,235929.00,A,A*6E\r\n"
+  "$GPRMC,235930.00,A,1823.10215,N,07829.20074,E,0.121,,141026,,,A*79\r\n"
+  "$GPVTG,,T,,M,0.015,N,0.014,K,A*22\r\n"
+  "$GPGGA,235930.00,1723.10215,N,07829.20074,E,1,08,0.94,543.3,M,-73.5,M,,*7F\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10215,N,07829.20074,E,235930.00,A,A*62\r\n"
+  "$GPRMC,235931.00,A,1723.10246,N,07829.20114,E,0.119,,141026,,,A*72\r\n"
+  "$GPVTG,,T,,M,0.061,N,0.061,K,A*23\r\n"
+  "$GPGGA,235931.00,1723.10246,N,07829.20114,E,1,08,0.94,540.2,M,-73.5,M,,*7D\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10246,N,07829.20114,E,235931.00,A,A*62\r\n"
+  "$GPRMC,235932.00,A,1723.10254,N,07829.20051,E,0.122,,141026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.088,N,0.020,K,A*21\r\n"
+  "$GPGGA,235932.00,1723.10254,N,07829.20051,E,1,08,0.94,542.3,M,-73.5,M,,*7E\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10254,N,07829.20051,E,235932.00,A,A*62\r\n"
+  "$GPRMC,235933.00,A,1723.10185,N,07829.19994,E,0.135,,141026,,,A*78\r\n"
+  "$GPVTG,,T,,M,0.046,N,0.018,K,A*28\r\n"
+  "$GPGGA,235933.00,1723.10185,N,07829.19994,E,1,08,0.94,542.2,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10185,N,07829.19994,E,235933.00,A,A*66\r\n"
+  "$GPRMC,235934.00,A,1723.10225,N,07829.19927,E,0.023,,141026,,,A*78\r\n"
+  "$GPVTG,,T,,M,0.089,N,0.033,K,A*22\r\n"
+  "$GPGGA,235934.00,1723.10225,N,07829.19927,E,1,08,0.94,542.3,M,-73.5,M,,*7C\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10225,N,07829.19927,E,235934.00,A,A*60\r\n"
+  "$GPRMC,235935.00,A,1723.10224,N,07829.19922,E,0.091,,141026,,,A*74\r\n"
+  "$GPVTG,,T,,M,0.098,N,0.028,K,A*28\r\n"
+  "$GPGGA,235935.00,1723.10224,N,07829.19922,E,1,08,0.94,542.1,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10224,N,07829.19922,E,235935.00,A,A*65\r\n"
+  "$GPRMC,235936.00,A,1723.10182,N,07829.20009,E,0.049,,141026,,,A*77\r\n"
+  "$GPVTG,,T,,M,0.030,N,0.051,K,A*24\r\n"
+  "$GPGGA,235936.00,1723.10182,N,07829.20009,E,1,08,0.94,542.0,M,-73.5,M,,*7C\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10182,N,07829.20009,E,235936.00,A,A*63\r\n"
+  "$GPRMC,235937.00,A,1723.10294,N,07829.20024,E,0.132,,141026,,,A*70\r\n"
+  "$GPVTG,,T,,M,0.063,N,0.045,K,A*27\r\n"
+  "$GPGGA,235937.00,1723.10294,N,07829.20024,E,1,08,0.94,541.7,M,-73.5,M,,*72\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10294,N,07829.20024,E,235937.00,A,A*69\r\n"
+  "$GPRMC,235938.00,A,1723.10247,N,07829.19882,E,0.049,,141026,,,A*72\r\n"
+  "$GPVTG,,T,,M,0.088,N,0.077,K,A*23\r\n"
+  "$GPGGA,235938.00,1723.10247,N,07829.19882,E,1,08,0.94,542.5,M,-73.5,M,,*7C\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10247,N,07829.19882,E,235938.00,A,A*66\r\n"
+  "$GPRMC,235939.00,A,1723.10211,N,07829.20076,E,0.089,,141026,,,A*75\r\n"
+  "$GPVTG,,T,,M,0.046,N,0.010,K,A*20\r\n"
+  "$GPGGA,235939.00,1723.10211,N,07829.20076,E,1,08,0.94,542.1,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10211,N,07829.20076,E,235939.00,A,A*6D\r\n"
+  "$GPRMC,235940.00,A,1723.10270,N,07829.20060,E,0.000,,141026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.061,N,0.083,K,A*2F\r\n"
+  "$GPGGA,235940.00,1723.10270,N,07829.20060,E,1,08,0.94,542.5,M,-73.5,M,,*79\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10270,N,07829.20060,E,235940.00,A,A*63\r\n"
+  "$GPRMC,235941.00,A,1723.10295,N,07829.19988,E,0.030,,141026,,,A*76\r\n"
+  "$GPVTG,,T,,M,0.049,N,0.091,K,A*26\r\n"
+  "$GPGGA,235941.00,1723.10295,N,07829.19988,E,1,08,0.94,543.3,M,-73.5,M,,*71\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10295,N,07829.19988,E,235941.00,A,A*6C\r\n"
+  "$GPRMC,235942.00,A,1723.10264,N,07829.19971,E,0.085,,141026,,,A*73\r\n"
+  "$GPVTG,,T,,M,0.011,N,0.092,K,A*28\r\n"
+  "$GPGGA,235942.00,1723.10264,N,07829.19971,E,1,08,0.94,542.9,M,-73.5,M,,*71\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10264,N,07829.19971,E,235942.00,A,A*67\r\n"
+  "$GPRMC,235943.00,A,1723.10340,N,07829.19987,E,0.021,,141026,,,A*72\r\n"
+  "$GPVTG,,T,,M,0.092,N,0.020,K,A*2A\r\n"
+  "$GPGGA,235943.00,1723.10340,N,07829.19987,E,1,08,0.94,542.8,M,-73.5,M,,*7F\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10340,N,07829.19987,E,235943.00,A,A*68\r\n"
+  "$GPRMC,235944.00,A,1723.10276,N,07829.20048,E,0.037,,141026,,,A*76\r\n"
+  "$GPVTG,,T,,M,0.078,N,0.076,K,A*2D\r\n"
+  "$GPGGA,235944.00,1723.10276,N,07829.20048,E,1,08,0.94,543.3,M,-73.5,M,,*76\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10276,N,07829.20048,E,235944.00,A,A*6B\r\n"
+  "$GPRMC,235945.00,A,1723.10349,N,07829.20096,E,0.089,,141026,,,A*7C\r\n"
+  "$GPVTG,,T,,M,0.019,N,0.070,K,A*2C\r\n"
+  "$GPGGA,235945.00,1723.10349,N,07829.20096,E,1,08,0.94,542.2,M,-73.5,M,,*79\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10349,N,07829.20096,E,235945.00,A,A*64\r\n"
+  "$GPRMC,235946.00,A,1723.10254,N,07829.20023,E,0.026,,141026,,,A*79\r\n"
+  "$GPVTG,,T,,M,0.067,N,0.095,K,A*2E\r\n"
+  "$GPGGA,235946.00,1723.10254,N,07829.20023,E,1,08,0.94,542.7,M,-73.5,M,,*7C\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10254,N,07829.20023,E,235946.00,A,A*64\r\n"
+  "$GPRMC,235947.00,A,1723.10190,N,07829.20073,E,0.049,,141026,,,A*7F\r\n"
+  "$GPVTG,,T,,M,0.027,N,0.003,K,A*25\r\n"
+  "$GPGGA,235947.00,1723.10190,N,07829.20073,E,1,08,0.94,542.0,M,-73.5,M,,*74\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10190,N,07829.20073,E,235947.00,A,A*6B\r\n"
+  "$GPRMC,235948.00,A,1723.10264,N,07829.20066,E,0.066,,141026,,,A*71\r\n"
+  "$GPVTG,,T,,M,0.069,N,0.053,K,A*2A\r\n"
+  "$GPGGA,235948.00,1723.10264,N,07829.20066,E,1,08,0.94,542.4,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10264,N,07829.20066,E,235948.00,A,A*68\r\n"
+  "$GPRMC,235949.00,A,1723.10328,N,07829.20035,E,0.090,,141026,,,A*76\r\n"
+  "$GPVTG,,T,,M,0.058,N,0.084,K,A*22\r\n"
+  "$GPGGA,235949.00,1723.10328,N,07829.20035,E,1,08,0.94,542.1,M,-73.5,M,,*78\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10328,N,07829.20035,E,235949.00,A,A*66\r\n"
+  "$GPRMC,235950.00,A,1723.10174,N,07829.19974,E,0.128,,141026,,,A*71\r\n"
+  "$GPVTG,,T,,M,0.016,N,0.068,K,A*2A\r\n"
+  "$GPGGA,235950.00,1723.10174,N,07829.19974,E,1,08,0.94,540.7,M,-73.5,M,,*79\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10174,N,07829.19974,E,235950.00,A,A*63\r\n"
+  "$GPRMC,235951.00,A,1723.10315,N,07829.20059,E,0.112,,141026,,,A*70\r\n"
+  "$GPVTG,,T,,M,0.099,N,0.023,K,A*22\r\n"
+  "$GPGGA,235951.00,1723.10315,N,07829.20059,E,1,08,0.94,543.1,M,-73.5,M,,*74\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10315,N,07829.20059,E,235951.00,A,A*6B\r\n"
+  "$GPRMC,235952.00,A,1723.10200,N,07829.19974,E,0.030,,141026,,,A*7B\r\n"
+  "$GPVTG,,T,,M,0.071,N,0.007,K,A*22\r\n"
+  "$GPGGA,235952.00,1723.10200,N,07829.19974,E,1,08,0.94,542.6,M,-73.5,M,,*78\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10200,N,07829.19974,E,235952.00,A,A*61\r\n"
+  "$GPRMC,235953.00,A,1723.10285,N,07829.19999,E,0.142,,141026,,,A*70\r\n"
+  "$GPVTG,,T,,M,0.061,N,0.099,K,A*24\r\n"
+  "$GPGGA,235953.00,1723.10285,N,07829.19999,E,1,08,0.94,543.2,M,-73.5,M,,*72\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10285,N,07829.19999,E,235953.00,A,A*6E\r\n"
+  "$GPRMC,235954.00,A,1723.10312,N,07829.20064,E,0.025,,141026,,,A*79\r\n"
+  "$GPVTG,,T,,M,0.064,N,0.057,K,A*23\r\n"
+  "$GPGGA,235954.00,1723.10312,N,07829.20064,E,1,08,0.94,542.3,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10312,N,07829.20064,E,235954.00,A,A*67\r\n"
+  "$GPRMC,235955.00,A,1723.10303,N,07829.19951,E,0.016,,141026,,,A*7D\r\n"
+  "$GPVTG,,T,,M,0.056,N,0.041,K,A*25\r\n"
+  "$GPGGA,235955.00,1723.10303,N,07829.19951,E,1,08,0.94,541.8,M,-73.5,M,,*77\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10303,N,07829.19951,E,235955.00,A,A*63\r\n"
+  "$GPRMC,235956.00,A,1723.10221,N,07829.19989,E,0.115,,141026,,,A*78\r\n"
+  "$GPVTG,,T,,M,0.065,N,0.068,K,A*2E\r\n"
+  "$GPGGA,235956.00,1723.10221,N,07829.19989,E,1,08,0.94,541.1,M,-73.5,M,,*79\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10221,N,07829.19989,E,235956.00,A,A*64\r\n"
+  "$GPRMC,235957.00,A,1723.10258,N,07829.20046,E,0.063,,141026,,,A*77\r\n"
+  "$GPVTG,,T,,M,0.089,N,0.066,K,A*22\r\n"
+  "$GPGGA,235957.00,1723.10258,N,07829.20046,E,1,08,0.94,541.4,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10258,N,07829.20046,E,235957.00,A,A*6B\r\n"
+  "$GPRMC,235958.00,A,1723.10346,N,07829.19946,E,0.051,,141026,,,A*74\r\n"
+  "$GPVTG,,T,,M,0.057,N,0.017,K,A*27\r\n"
+  "$GPGGA,235958.00,1723.10346,N,07829.19946,E,1,08,0.94,542.2,M,-73.5,M,,*74\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10346,N,07829.19946,E,235958.00,A,A*69\r\n"
+  "$GPRMC,235959.00,A,1723.10325,N,07829.19985,E,0.080,,141026,,,A*73\r\n"
+  "$GPVTG,,T,,M,0.009,N,0.085,K,A*27\r\n"
+  "$GPGGA,235959.00,1723.10325,N,07829.19985,E,1,08,0.94,542.7,M,-73.5,M,,*7A\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10325,N,07829.19985,E,235959.00,A,A*62\r\n"
+  "$GPRMC,000000.00,A,1723.10265,N,07829.20045,E,0.039,,151026,,,A*7B\r\n"
+  "$GPVTG,,T,,M,0.091,N,0.082,K,A*21\r\n"
+  "$GPGGA,000000.00,1723.10265,N,07829.20045,E,1,08,0.94,541.6,M,-73.5,M,,*73\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10265,N,07829.20045,E,000000.00,A,A*69\r\n"
+  "$GPRMC,000001.00,A,1723.10191,N,07829.20012,E,0.035,,151026,,,A*7C\r\n"
+  "$GPVTG,,T,,M,0.059,N,0.028,K,A*25\r\n"
+  "$GPGGA,000001.00,1723.10191,N,07829.20012,E,1,08,0.94,541.9,M,-73.5,M,,*77\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10191,N,07829.20012,E,000001.00,A,A*62\r\n"
+  "$GPRMC,000002.00,A,1723.10264,N,07829.20005,E,0.057,,151026,,,A*74\r\n"
+  "$GPVTG,,T,,M,0.020,N,0.090,K,A*28\r\n"
+  "$GPGGA,000002.00,1723.10264,N,07829.20005,E,1,08,0.94,542.7,M,-73.5,M,,*76\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10264,N,07829.20005,E,000002.00,A,A*6E\r\n"
+  "$GPRMC,000003.00,A,1723.10245,N,07829.19973,E,0.086,,151026,,,A*78\r\n"
+  "$GPVTG,,T,,M,0.053,N,0.025,K,A*22\r\n"
+  "$GPGGA,000003.00,1723.10245,N,07829.19973,E,1,08,0.94,542.7,M,-73.5,M,,*76\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10245,N,07829.19973,E,000003.00,A,A*6E\r\n"
+  "$GPRMC,000004.00,A,1723.10251,N,07829.20043,E,0.117,,151026,,,A*73\r\n"
+  "$GPVTG,,T,,M,0.056,N,0.090,K,A*29\r\n"
+  "$GPGGA,000004.00,1723.10251,N,07829.20043,E,1,08,0.94,541.8,M,-73.5,M,,*78\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10251,N,07829.20043,E,000004.00,A,A*6C\r\n"
+  "$GPRMC,000005.00,A,1723.10297,N,07829.20069,E,0.075,,151026,,,A*75\r\n"
+  "$GPVTG,,T,,M,0.065,N,0.008,K,A*28\r\n"
+  "$GPGGA,000005.00,1723.10297,N,07829.20069,E,1,08,0.94,542.4,M,-73.5,M,,*74\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10297,N,07829.20069,E,000005.00,A,A*6F\r\n"
+  "$GPRMC,000006.00,A,1723.10346,N,07829.20096,E,0.021,,151026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.033,N,0.034,K,A*24\r\n"
+  "$GPGGA,000006.00,1723.10346,N,07829.20096,E,1,08,0.94,542.5,M,-73.5,M,,*7B\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10346,N,07829.20096,E,000006.00,A,A*61\r\n"
+  "$GPRMC,000007.00,A,1723.10361,N,07829.20107,E,0.069,,151026,,,A*7B\r\n"
+  "$GPVTG,,T,,M,0.096,N,0.016,K,A*2B\r\n"
+  "$GPGGA,000007.00,1723.10361,N,07829.20107,E,1,08,0.94,542.6,M,-73.5,M,,*75\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10361,N,07829.20107,E,000007.00,A,A*6C\r\n"
+  "$GPRMC,000008.00,A,1723.10304,N,07829.19941,E,0.103,,151026,,,A*7A\r\n"
+  "$GPVTG,,T,,M,0.019,N,0.068,K,A*25\r\n"
+  "$GPGGA,000008.00,1723.10304,N,07829.19941,E,1,08,0.94,541.4,M,-73.5,M,,*78\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10304,N,07829.19941,E,000008.00,A,A*60\r\n"
+  "$GPRMC,000009.00,A,1723.10160,N,07829.20081,E,0.083,,151026,,,A*7D\r\n"
+  "$GPVTG,,T,,M,0.011,N,0.035,K,A*25\r\n"
+  "$GPGGA,000009.00,1723.10160,N,07829.20081,E,1,08,0.94,541.8,M,-73.5,M,,*7A\r\n"
+  "$GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32*08\r\n"
+  "$GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25*7C\r\n"
+  "$GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44*7C\r\n"
+  "$GPGSV,3,3,10,10,05,090,,12,02,140,*71\r\n"
+  "$GPGLL,1723.10160,N,07829.20081,E,000009.00,A,A*6E\r\n"
+  ;
+
+#endif // NMEA_LOG_H
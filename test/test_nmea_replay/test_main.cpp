@@ -0,0 +1,247 @@
+/**
+ * @file test_main.cpp
+ * @brief NMEA log replay: parse results and parse throughput (host)
+ *
+ * Replays the log in nmea_log.h through the same path as the firmware: a
+ * serial port with the AVR core's 64 byte receive buffer filling at the
+ * GPS baud rate, GpsRxBuffer captures every 2 ms (the Timer1 interrupt),
+ * and GpsReceiver parses what was captured. The tests check that no byte is
+ * lost, that the sentence filter and checksums give the counts the log
+ * implies, and report the parse throughput on the host.
+ *
+ * To replay a capture instead, convert it with tools/nmea_fixture.py.
+ *
+ * Run with: pio test -e native -f test_nmea_replay -v
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include <chrono>
+#include <unity.h>
+#include <Arduino.h>
+#include "GpsReceiver.h"
+#include "GpsRxBuffer.h"
+#include "GpsStabilityFilter.h"
+#include "nmea_log.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** Serial setup of the clock (config.h) */
+static const unsigned long GPS_BAUD_RATE = 115200;
+static const uint16_t GPS_RX_BUFFER_SIZE = 128;
+static const unsigned long CAPTURE_PERIOD_US = 2000;
+
+/** Bytes per second on the wire: 8N1 framing is 10 bits per byte */
+static const unsigned long BYTES_PER_SECOND = GPS_BAUD_RATE / 10;
+
+// ============================================================================
+// REPLAY STREAM
+// ============================================================================
+
+/**
+ * @class ReplayStream
+ * @brief Serial port receiving a log at the baud rate, with a bounded FIFO
+ *
+ * Bytes "arrive" as simulated time passes. Like the AVR core, bytes that
+ * arrive while the receive buffer is full are lost and counted.
+ */
+class ReplayStream : public Stream {
+public:
+  ReplayStream(const char* log, size_t size)
+    : log(log), size(size), arrived(0), consumed(0), overruns(0) {}
+
+  /** Deliver the bytes received up to the current micros() */
+  void receive() {
+    size_t due = (size_t)((unsigned long long)micros() * BYTES_PER_SECOND / 1000000ULL);
+    if (due > size) due = size;
+    while (arrived < due) {
+      if (arrived - consumed >= SERIAL_RX_BUFFER_SIZE - 1) {
+        // Hardware buffer full: the byte is lost, but still skipped in the log
+        consumed++;
+        overruns++;
+      }
+      arrived++;
+    }
+  }
+
+  bool finished() const { return consumed == size; }
+  unsigned long getOverruns() const { return overruns; }
+
+  int available() { return (int)(arrived - consumed); }
+  int read() { return consumed < arrived ? (uint8_t)log[consumed++] : -1; }
+  int peek() { return consumed < arrived ? (uint8_t)log[consumed] : -1; }
+  size_t write(uint8_t value) { (void)value; return 1; }
+
+private:
+  const char* log;
+  size_t size;
+  size_t arrived;
+  size_t consumed;
+  unsigned long overruns;
+};
+
+// ============================================================================
+// LOG SCAN
+// ============================================================================
+
+/**
+ * @struct LogSummary
+ * @brief What the log should produce, found by scanning it independently
+ */
+struct LogSummary {
+  unsigned long sentences;        /**< All sentences in the log */
+  unsigned long acceptedValid;    /**< RMC/GGA sentences with a correct checksum */
+  unsigned long acceptedCorrupt;  /**< RMC/GGA sentences with a wrong checksum */
+  unsigned long fixSentences;     /**< Valid RMC with status A or GGA with quality > 0 */
+};
+
+/**
+ * @brief Find a comma separated field of a sentence
+ * @param sentence Sentence starting at '$'
+ * @param index Field number (0 is the "$ttSSS" header)
+ * @return First character of the field
+ */
+static const char* field(const char* sentence, uint8_t index) {
+  while (index > 0 && *sentence != '*' && *sentence != '\r') {
+    if (*sentence++ == ',') index--;
+  }
+  return sentence;
+}
+
+/**
+ * @brief Count the sentences of the log the receiver should accept and fix on
+ * @return Summary of NMEA_LOG
+ */
+static LogSummary scanLog() {
+  LogSummary summary = { 0, 0, 0, 0 };
+
+  for (const char* sentence = NMEA_LOG; (sentence = strchr(sentence, '$')) != 0; sentence++) {
+    summary.sentences++;
+    const char* type = sentence + 3;
+    bool rmc = strncmp(type, "RMC", 3) == 0;
+    bool gga = strncmp(type, "GGA", 3) == 0;
+    if (!rmc && !gga) continue;
+
+    uint8_t checksum = 0;
+    const char* p = sentence + 1;
+    while (*p != '*') checksum ^= (uint8_t)*p++;
+    if (checksum != (uint8_t)strtoul(p + 1, 0, 16)) {
+      summary.acceptedCorrupt++;
+      continue;
+    }
+    summary.acceptedValid++;
+
+    if (rmc && *field(sentence, 2) == 'A') summary.fixSentences++;
+    if (gga && *field(sentence, 6) > '0') summary.fixSentences++;
+  }
+  return summary;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_replay_loses_no_bytes_and_parses_every_sentence() {
+  static uint8_t storage[GPS_RX_BUFFER_SIZE];
+  const size_t logSize = sizeof(NMEA_LOG) - 1;
+  ReplayStream port(NMEA_LOG, logSize);
+  GpsRxBuffer rxBuffer(port, storage, GPS_RX_BUFFER_SIZE);
+  GpsReceiver gps;
+  GpsStabilityFilter filter(gps);
+  LogSummary expected = scanLog();
+
+  unsigned long timeUpdates = 0;
+  unsigned long locationUpdates = 0;
+  mockSetMillis(0);
+
+  while (!port.finished()) {
+    delayMicroseconds(CAPTURE_PERIOD_US);
+    port.receive();
+    rxBuffer.capture();
+
+    // Main loop: parse everything captured, as drainGps() does
+    int receivedByte;
+    while ((receivedByte = rxBuffer.read()) >= 0) {
+      if (!gps.encode((char)receivedByte)) continue;
+      if (gps.isTimeUpdated()) timeUpdates++;
+      if (gps.isLocationUpdated()) {
+        locationUpdates++;
+        filter.update();
+      }
+    }
+  }
+
+  GpsRxStats stats;
+  rxBuffer.getStats(stats);
+  char line[160];
+  snprintf(line, sizeof(line),
+           "replay: %lu sentences, %lu bytes in %lu ms, rx:%lu/%u high water:%u, passed:%lu failed:%lu",
+           expected.sentences, (unsigned long)logSize, millis(), (unsigned long)stats.bytesDropped,
+           stats.hardwareOverflows, stats.highWaterMark,
+           (unsigned long)gps.passedChecksums(), (unsigned long)gps.failedChecksums());
+  TEST_MESSAGE(line);
+
+  // The PROF line's "rx:0/0": nothing dropped, no hardware overrun
+  TEST_ASSERT_EQUAL_UINT32(0, port.getOverruns());
+  TEST_ASSERT_EQUAL_UINT32(0, stats.bytesDropped);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.hardwareOverflows);
+  TEST_ASSERT_EQUAL_UINT32(logSize, stats.bytesReceived);
+
+  // Only RMC/GGA reach the parser; the damaged one fails its checksum
+  TEST_ASSERT_EQUAL_UINT32(expected.acceptedValid, gps.passedChecksums());
+  TEST_ASSERT_EQUAL_UINT32(expected.acceptedCorrupt, gps.failedChecksums());
+  TEST_ASSERT_EQUAL_UINT32(expected.fixSentences, locationUpdates);
+  TEST_ASSERT_TRUE(timeUpdates >= locationUpdates);
+
+  // Specific to the bundled log, update when replacing it: it ends
+  // stationary at its fixed point, after midnight UTC
+  TEST_ASSERT_TRUE(filter.hasFilteredPosition());
+  TEST_ASSERT_INT32_WITHIN(100, 173850440L, filter.getFilteredLatitudeE7());
+  TEST_ASSERT_INT32_WITHIN(100, 784866710L, filter.getFilteredLongitudeE7());
+  TEST_ASSERT_EQUAL_UINT8(0, gps.hour());
+  TEST_ASSERT_EQUAL_UINT8(15, gps.day());
+}
+
+void test_parse_throughput() {
+  const size_t logSize = sizeof(NMEA_LOG) - 1;
+  const uint8_t passes = 20;
+  GpsReceiver gps;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (uint8_t pass = 0; pass < passes; pass++) {
+    for (size_t i = 0; i < logSize; i++) {
+      gps.encode(NMEA_LOG[i]);
+    }
+  }
+  double hostNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  unsigned long bytes = (unsigned long)logSize * passes;
+  char line[120];
+  snprintf(line, sizeof(line), "BENCH nmea parse   bytes:%lu host:%.1f ns/byte (%.0f kB/s)",
+           bytes, hostNs / bytes, bytes / hostNs * 1e6);
+  TEST_MESSAGE(line);
+
+  TEST_ASSERT_EQUAL_UINT32(scanLog().acceptedValid * passes, gps.passedChecksums());
+}
+
+// ============================================================================
+// TEST RUNNER
+// ============================================================================
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_loses_no_bytes_and_parses_every_sentence);
+  RUN_TEST(test_parse_throughput);
+  return UNITY_END();
+}
@@ -0,0 +1,385 @@
+/**
+ * @file gps-sim.chip.c
+ * @brief Wokwi custom chip: scripted GPS receiver and timing checker
+ *
+ * Plays a GPS module for the simulated clock. Once per second it sends a
+ * u-blox style NMEA burst (RMC, VTG, GGA, GSA, 3x GSV, GLL) at 115200 baud
+ * and pulses PPS, following a fixed script:
+ *
+ *   0-7 s     cold start: sentences without time or position
+ *   8-11 s    time known, no fix yet
+ *   12-44 s   3D fix; UTC 18:29:42-18:30:14, so IST rolls over the minute,
+ *             the hour and the date at 30 s
+ *   45-59 s   signal loss: no sentences, no PPS
+ *   60-99 s   recovery, 3D fix again; minute rollover at 90 s
+ *
+ * The clock's serial output comes back on RX. Every "PROF" line (profiling
+ * build) is checked:
+ * - ovr:0, no loop iteration over the frame budget
+ * - rx: no GPS byte lost in the ring buffer or the serial hardware since the
+ *   previous report (the counters run since boot; what the first report
+ *   shows was lost during setup() and is only logged)
+ * - colon: toggle jitter at most colonLimitUs, for reports whose whole
+ *   interval lies inside a fix phase (phase changes re-time the colon)
+ * - isr: the capture interrupt never ran longer than isrLimitUs with
+ *   interrupts off (default 170us, two byte times: the USART buffers less
+ *   than three, and an overrun there is not counted in rx)
+ * - pps: with requirePps set, the same reports must show the PPS clock
+ *   locked, with a display latency of at most colonLimitUs
+ *
+ * At 100 s DONE goes high, and PASS goes high if every check held and at
+ * least minReports reports arrived. Findings are printed to the simulator
+ * log. test/wokwi/gps-timing.test.yaml asserts on both pins.
+ *
+ * Build: see test/wokwi/README.md
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#include "wokwi-api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// SCRIPT
+// ============================================================================
+
+#define COLD_START_END_S      8     // First second with time
+#define FIX_START_S           12    // First second with a fix
+#define SIGNAL_LOSS_START_S   45    // First silent second
+#define RECOVERY_START_S      60    // First second after the loss
+#define SCRIPT_END_S          100   // Checks are evaluated here
+
+/** UTC at script second 0: 2026-10-14 18:29:30 (00:00 IST at 30 s) */
+#define SCRIPT_START_UTC      1792002570UL
+
+/** Position reported during a fix (degrees and minutes, as in NMEA) */
+#define FIX_LATITUDE          "1723.10260"
+#define FIX_LONGITUDE         "07829.20026"
+
+#define GPS_BAUD_RATE         115200
+#define PPS_PULSE_US          100000
+
+/** PROF reports are 5 s apart (PROFILE_REPORT_INTERVAL_MS) */
+#define REPORT_INTERVAL_S     5
+
+/** Time after a phase change before colon jitter is checked */
+#define COLON_SETTLE_S        2
+
+// ============================================================================
+// CHIP STATE
+// ============================================================================
+
+typedef struct {
+  uart_dev_t uart;
+  pin_t ppsPin;
+  pin_t donePin;
+  pin_t passPin;
+  timer_t secondTimer;
+  timer_t ppsTimer;
+
+  uint32_t second;             // Script second being sent
+  char burst[1024];            // Sentences of the current second
+  bool writing;                // UART write of burst in progress
+
+  char line[160];              // Serial line from the clock being received
+  uint32_t lineLength;
+
+  uint32_t colonLimitUs;
+  uint32_t minReports;
+  uint32_t isrLimitUs;
+  bool requirePps;
+  long rxDropped;              // rx counters of the previous report, -1 before the first
+  long rxOverflows;
+  uint32_t reports;
+  uint32_t failures;
+  bool finished;
+} chip_state_t;
+
+// ============================================================================
+// NMEA GENERATION
+// ============================================================================
+
+/**
+ * @brief Append one sentence with its checksum and CR LF to the burst
+ * @param chip Chip state
+ * @param body Sentence between '$' and '*'
+ */
+static void append_sentence(chip_state_t *chip, const char *body) {
+  uint8_t checksum = 0;
+  for (const char *p = body; *p; p++) checksum ^= (uint8_t)*p;
+
+  size_t used = strlen(chip->burst);
+  snprintf(chip->burst + used, sizeof(chip->burst) - used, "$%s*%02X\r\n", body, checksum);
+}
+
+/**
+ * @brief Convert seconds since 1970 to NMEA time and date fields
+ * @param utc Seconds since 1970-01-01 UTC
+ * @param timeField Receives "hhmmss.00"
+ * @param dateField Receives "ddmmyy"
+ */
+static void format_utc(uint32_t utc, char *timeField, char *dateField) {
+  uint32_t days = utc / 86400UL;
+  uint32_t secondOfDay = utc % 86400UL;
+
+  // Civil date from days since 1970 (proleptic Gregorian, valid to 2099)
+  uint32_t year = 1970;
+  while (days >= ((year % 4 == 0) ? 366U : 365U)) {
+    days -= (year % 4 == 0) ? 366U : 365U;
+    year++;
+  }
+  static const uint8_t monthDays[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  uint32_t month = 0;
+  while (days >= monthDays[month] + ((month == 1 && year % 4 == 0) ? 1U : 0U)) {
+    days -= monthDays[month] + ((month == 1 && year % 4 == 0) ? 1U : 0U);
+    month++;
+  }
+
+  sprintf(timeField, "%02u%02u%02u.00", (unsigned)(secondOfDay / 3600),
+          (unsigned)(secondOfDay / 60 % 60), (unsigned)(secondOfDay % 60));
+  sprintf(dateField, "%02u%02u%02u", (unsigned)(days + 1), (unsigned)(month + 1), (unsigned)(year % 100));
+}
+
+/**
+ * @brief Build the sentences for one script second
+ * @param chip Chip state
+ * @param second Script second
+ * @return False if the GPS is silent in this second
+ */
+static bool build_burst(chip_state_t *chip, uint32_t second) {
+  char timeField[16];
+  char dateField[8];
+  char body[128];
+
+  chip->burst[0] = '\0';
+  if (second >= SIGNAL_LOSS_START_S && second < RECOVERY_START_S) return false;
+
+  bool hasTime = second >= COLD_START_END_S;
+  bool hasFix = second >= FIX_START_S;
+  format_utc(SCRIPT_START_UTC + second, timeField, dateField);
+
+  if (!hasTime) {
+    append_sentence(chip, "GPRMC,,V,,,,,,,,,,N");
+    append_sentence(chip, "GPVTG,,,,,,,,,N");
+    append_sentence(chip, "GPGGA,,,,,,0,00,99.99,,,,,,");
+    append_sentence(chip, "GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99");
+    append_sentence(chip, "GPGSV,1,1,00");
+    append_sentence(chip, "GPGLL,,,,,,V,N");
+    return true;
+  }
+
+  if (!hasFix) {
+    snprintf(body, sizeof(body), "GPRMC,%s,V,,,,,,,%s,,,N", timeField, dateField);
+    append_sentence(chip, body);
+    append_sentence(chip, "GPVTG,,,,,,,,,N");
+    snprintf(body, sizeof(body), "GPGGA,%s,,,,,0,03,,,,,,,", timeField);
+    append_sentence(chip, body);
+    append_sentence(chip, "GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99");
+    append_sentence(chip, "GPGSV,1,1,03,05,42,110,28,13,21,250,22,15,65,040,30");
+    snprintf(body, sizeof(body), "GPGLL,,,,,%s,V,N", timeField);
+    append_sentence(chip, body);
+    return true;
+  }
+
+  snprintf(body, sizeof(body), "GPRMC,%s,A,%s,N,%s,E,0.012,,%s,,,A", timeField, FIX_LATITUDE, FIX_LONGITUDE, dateField);
+  append_sentence(chip, body);
+  append_sentence(chip, "GPVTG,,T,,M,0.012,N,0.022,K,A");
+  snprintf(body, sizeof(body), "GPGGA,%s,%s,N,%s,E,1,08,0.94,542.3,M,-73.5,M,,", timeField, FIX_LATITUDE, FIX_LONGITUDE);
+  append_sentence(chip, body);
+  append_sentence(chip, "GPGSA,A,3,05,13,15,18,20,24,25,29,,,,,1.62,0.94,1.32");
+  append_sentence(chip, "GPGSV,3,1,10,05,42,110,38,13,21,250,32,15,65,040,40,18,12,300,25");
+  append_sentence(chip, "GPGSV,3,2,10,20,55,180,41,24,08,020,18,25,33,330,35,29,70,210,44");
+  append_sentence(chip, "GPGSV,3,3,10,10,05,090,,12,02,140,");
+  snprintf(body, sizeof(body), "GPGLL,%s,N,%s,E,%s,A,A", FIX_LATITUDE, FIX_LONGITUDE, timeField);
+  append_sentence(chip, body);
+  return true;
+}
+
+// ============================================================================
+// PROF LINE CHECKS
+// ============================================================================
+
+/**
+ * @brief Check if a report interval lies inside a fix phase, after settling
+ * @param reportSecond Script second the report arrived in
+ */
+static bool in_steady_fix(uint32_t reportSecond) {
+  uint32_t intervalStart = reportSecond >= REPORT_INTERVAL_S + 1 ? reportSecond - REPORT_INTERVAL_S - 1 : 0;
+  bool firstFix = intervalStart >= FIX_START_S + COLON_SETTLE_S && reportSecond < SIGNAL_LOSS_START_S;
+  bool recovery = intervalStart >= RECOVERY_START_S + COLON_SETTLE_S && reportSecond < SCRIPT_END_S;
+  return firstFix || recovery;
+}
+
+/**
+ * @brief Read the number after "<key>" in a report
+ * @return Value, or -1 if the key is missing or not followed by a number
+ */
+static long report_value(const char *line, const char *key) {
+  const char *found = strstr(line, key);
+  if (!found) return -1;
+  found += strlen(key);
+  return (*found >= '0' && *found <= '9') ? strtol(found, NULL, 10) : -1;
+}
+
+/**
+ * @brief Check one "PROF ..." line against the pass criteria
+ */
+static void check_report(chip_state_t *chip, const char *line) {
+  uint32_t second = (uint32_t)(get_sim_nanos() / 1000000000ULL);
+  chip->reports++;
+
+  long overruns = report_value(line, "ovr:");
+  if (overruns != 0) {
+    printf("gps-sim: FAIL at %us, frame overruns: %s\n", (unsigned)second, line);
+    chip->failures++;
+  }
+
+  long dropped = -1;
+  long overflows = -1;
+  const char *rx = strstr(line, "rx:");
+  if (!rx || sscanf(rx, "rx:%ld/%ld", &dropped, &overflows) != 2) {
+    printf("gps-sim: FAIL at %us, no rx field: %s\n", (unsigned)second, line);
+    chip->failures++;
+  } else if (chip->rxDropped < 0) {
+    printf("gps-sim: %ld bytes dropped, %ld overflows during setup()\n", dropped, overflows);
+  } else if (dropped != chip->rxDropped || overflows != chip->rxOverflows) {
+    printf("gps-sim: FAIL at %us, GPS receive overrun: %s\n", (unsigned)second, line);
+    chip->failures++;
+  }
+  chip->rxDropped = dropped;
+  chip->rxOverflows = overflows;
+
+  long blocked = report_value(line, "isr:");
+  if (blocked < 0 || blocked > (long)chip->isrLimitUs) {
+    printf("gps-sim: FAIL at %us, capture interrupt over %uus with interrupts off: %s\n", (unsigned)second, (unsigned)chip->isrLimitUs, line);
+    chip->failures++;
+  }
+
+  bool steady = in_steady_fix(second);
+  long colon = report_value(line, "colon:");
+  if (colon < 0 || (steady && colon > (long)chip->colonLimitUs)) {
+    printf("gps-sim: FAIL at %us, colon jitter over %uus: %s\n", (unsigned)second, (unsigned)chip->colonLimitUs, line);
+    chip->failures++;
+  }
+
+  // "pps:-" (not locked) reads as -1, like a missing field
+  long latency = report_value(line, "pps:");
+  if (chip->requirePps && steady && (latency < 0 || latency > (long)chip->colonLimitUs)) {
+    printf("gps-sim: FAIL at %us, PPS not locked or latency over %uus: %s\n", (unsigned)second, (unsigned)chip->colonLimitUs, line);
+    chip->failures++;
+  }
+}
+
+/**
+ * @brief Finish the run: evaluate the totals and set DONE and PASS
+ */
+static void finish(chip_state_t *chip) {
+  chip->finished = true;
+  if (chip->reports < chip->minReports) {
+    printf("gps-sim: FAIL, %u PROF reports, expected at least %u (profiling build?)\n",
+           (unsigned)chip->reports, (unsigned)chip->minReports);
+    chip->failures++;
+  }
+
+  printf("gps-sim: %s, %u reports, %u failures\n", chip->failures ? "FAIL" : "PASS",
+         (unsigned)chip->reports, (unsigned)chip->failures);
+  pin_write(chip->passPin, chip->failures ? LOW : HIGH);
+  pin_write(chip->donePin, HIGH);
+}
+
+// ============================================================================
+// CALLBACKS
+// ============================================================================
+
+static void on_second(void *user_data) {
+  chip_state_t *chip = (chip_state_t *)user_data;
+  if (chip->finished) return;
+
+  uint32_t second = chip->second++;
+  if (second >= SCRIPT_END_S) {
+    finish(chip);
+    return;
+  }
+
+  if (!build_burst(chip, second)) return;
+
+  // PPS leads the sentences of its second, like real receivers
+  if (second >= FIX_START_S) {
+    pin_write(chip->ppsPin, HIGH);
+    timer_start(chip->ppsTimer, PPS_PULSE_US, false);
+  }
+
+  if (chip->writing) {
+    printf("gps-sim: burst of second %u dropped, previous one still sending\n", (unsigned)second);
+    return;
+  }
+  chip->writing = true;
+  if (!uart_write(chip->uart, (uint8_t *)chip->burst, strlen(chip->burst))) chip->writing = false;
+}
+
+static void on_pps_end(void *user_data) {
+  chip_state_t *chip = (chip_state_t *)user_data;
+  pin_write(chip->ppsPin, LOW);
+}
+
+static void on_write_done(void *user_data) {
+  chip_state_t *chip = (chip_state_t *)user_data;
+  chip->writing = false;
+}
+
+static void on_rx_data(void *user_data, uint8_t byte) {
+  chip_state_t *chip = (chip_state_t *)user_data;
+
+  if (byte == '\r' || byte == '\n') {
+    chip->line[chip->lineLength] = '\0';
+    if (!chip->finished && strncmp(chip->line, "PROF ", 5) == 0) check_report(chip, chip->line);
+    chip->lineLength = 0;
+    return;
+  }
+
+  // Anything else on the line (receiver commands, debug text) is skipped;
+  // over-long lines are cut, which never affects PROF lines
+  if (chip->lineLength < sizeof(chip->line) - 1) chip->line[chip->lineLength++] = (char)byte;
+}
+
+// ============================================================================
+// ENTRY POINT
+// ============================================================================
+
+void chip_init(void) {
+  chip_state_t *chip = calloc(1, sizeof(chip_state_t));
+
+  chip->ppsPin = pin_init("PPS", OUTPUT_LOW);
+  chip->donePin = pin_init("DONE", OUTPUT_LOW);
+  chip->passPin = pin_init("PASS", OUTPUT_LOW);
+  chip->second = 1;  // The first timer event is at 1 s: script seconds are simulation seconds
+  chip->colonLimitUs = attr_read(attr_init("colonLimitUs", 25000));
+  chip->minReports = attr_read(attr_init("minReports", 15));
+  chip->isrLimitUs = attr_read(attr_init("isrLimitUs", 170));
+  chip->requirePps = attr_read(attr_init("requirePps", 1)) != 0;
+  chip->rxDropped = -1;
+  chip->rxOverflows = -1;
+
+  const uart_config_t uart_config = {
+    .tx = pin_init("TX", INPUT_PULLUP),
+    .rx = pin_init("RX", INPUT),
+    .baud_rate = GPS_BAUD_RATE,
+    .rx_data = on_rx_data,
+    .write_done = on_write_done,
+    .user_data = chip,
+  };
+  chip->uart = uart_init(&uart_config);
+
+  const timer_config_t second_config = { .callback = on_second, .user_data = chip };
+  chip->secondTimer = timer_init(&second_config);
+  const timer_config_t pps_config = { .callback = on_pps_end, .user_data = chip };
+  chip->ppsTimer = timer_init(&pps_config);
+
+  timer_start(chip->secondTimer, 1000000, true);
+  printf("gps-sim: scripted GPS at %u baud, checks end at %us\n", (unsigned)GPS_BAUD_RATE, (unsigned)SCRIPT_END_S);
+}
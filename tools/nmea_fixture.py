@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Converts a captured NMEA log into the C header replayed by the native test
+test/test_nmea_replay (pio test -e native).
+
+Every line starting with '$' is kept as-is, with CR LF line endings as sent by
+the GPS module; other lines (timestamps from a terminal program, blank
+lines) are dropped. Checksums are not fixed up, so corrupted sentences in a
+capture stay corrupted and show up in the failed checksum count.
+
+Usage:
+    python3 tools/nmea_fixture.py capture.nmea test/test_nmea_replay/nmea_log.h
+
+A capture can be taken with the GPS module on a USB serial adapter, e.g.
+    pio device monitor -p /dev/ttyUSB0 -b 9600 --quiet > capture.nmea
+
+Author: zeevy
+License: MIT
+"""
+
+import argparse
+import sys
+
+HEADER = """\
+/**
+ * @file nmea_log.h
+ * @brief NMEA log replayed by the parse throughput test
+ *
+ * {description}
+ * Generated by tools/nmea_fixture.py ({lines} sentences, {size} bytes).
+ *
+ * @author zeevy
+ * @version 1.0.0
+ * @date 2026-10-14
+ * @license MIT
+ */
+
+#ifndef NMEA_LOG_H
+#define NMEA_LOG_H
+
+static const char NMEA_LOG[] =
+"""
+
+FOOTER = """\
+  ;
+
+#endif // NMEA_LOG_H
+"""
+
+
+def read_sentences(path):
+    """Return the NMEA sentences of a log file, without line endings."""
+    with open(path, "r", encoding="ascii", errors="replace") as log:
+        return [line.strip() for line in log if line.startswith("$")]
+
+
+def c_string(sentence):
+    """Quote one sentence as a C string literal line, CR LF included."""
+    escaped = sentence.replace("\\", "\\\\").replace('"', '\\"')
+    return '  "%s\\r\\n"\n' % escaped
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", help="captured NMEA log")
+    parser.add_argument("header", help="C header to write")
+    parser.add_argument("--description", default="Captured GPS module output.",
+                        help="one line describing the log, for the header comment")
+    args = parser.parse_args()
+
+    sentences = read_sentences(args.log)
+    if not sentences:
+        sys.exit("no NMEA sentences in %s" % args.log)
+
+    size = sum(len(sentence) + 2 for sentence in sentences)
+    with open(args.header, "w", encoding="ascii") as header:
+        header.write(HEADER.format(description=args.description, lines=len(sentences), size=size))
+        for sentence in sentences:
+            header.write(c_string(sentence))
+        header.write(FOOTER)
+
+
+if __name__ == "__main__":
+    main()
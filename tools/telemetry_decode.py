@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+Decoder for the GPS clock binary telemetry stream (ENABLE_TELEMETRY).
+
+Reads COBS frames from a serial port (or a capture file) and prints one line
+per packet. Frames that fail to decode but contain printable text, such as
+the replies to serial commands, are printed as text.
+
+Packet layout: see src/Telemetry.h.
+
+Usage:
+    python3 tools/telemetry_decode.py /dev/ttyUSB0 [--baud 115200]
+    python3 tools/telemetry_decode.py capture.bin
+
+Requires pyserial for serial ports (pip install pyserial).
+
+Author: zeevy
+License: MIT
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+
+TELEMETRY_STATUS = 0x01
+TELEMETRY_POSITION = 0x02
+TELEMETRY_HEALTH = 0x03
+
+STATUS_FORMAT = "<IBBhBBH"
+POSITION_FORMAT = "<iiiii"
+HEALTH_FORMAT = "<IIIHBH"
+
+TIME_SOURCES = {0: "none", 1: "gps", 2: "rtc"}
+
+FLAG_NAMES = (
+    (0x01, "gps-time"),
+    (0x02, "location"),
+    (0x04, "moving"),
+    (0x08, "dst"),
+    (0x10, "pps"),
+)
+
+
+ESCAPE = 0x7D
+ESCAPE_XOR = 0x20
+
+
+def unescape(frame):
+    """Undo the escaping of '$', 0xB5 and 0x7D (see src/Telemetry.h)."""
+    output = bytearray()
+    escaped = False
+    for byte in frame:
+        if escaped:
+            output.append(byte ^ ESCAPE_XOR)
+            escaped = False
+        elif byte == ESCAPE:
+            escaped = True
+        else:
+            output.append(byte)
+    if escaped:
+        raise ValueError("frame ends in an escape byte")
+    return bytes(output)
+
+
+def cobs_decode(frame):
+    """Decode one COBS frame (without the 0x00 delimiter)."""
+    output = bytearray()
+    index = 0
+    while index < len(frame):
+        code = frame[index]
+        if code == 0 or index + code > len(frame) + 1:
+            raise ValueError("invalid COBS code")
+        output += frame[index + 1:index + code]
+        index += code
+        if code < 0xFF and index < len(frame):
+            output.append(0)
+    return bytes(output)
+
+
+def crc8(data):
+    """CRC-8, polynomial 0x07, initial value 0 (as in Telemetry.cpp)."""
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def format_degrees(value_e7):
+    return "%.7f" % (value_e7 / 1e7)
+
+
+def format_packet(packet_type, payload):
+    """Return a text line for one packet payload."""
+    if packet_type == TELEMETRY_STATUS:
+        utc, source, flags, offset, readings, brightness, failed = struct.unpack(STATUS_FORMAT, payload)
+        when = datetime.datetime.fromtimestamp(utc, datetime.timezone.utc).strftime("%Y-%m-%d %H:%M:%S") if utc else "-"
+        names = ",".join(name for bit, name in FLAG_NAMES if flags & bit) or "-"
+        return "STATUS utc=%s src=%s flags=%s offset=%+dmin readings=%d brightness=%d bad-checksums=%d" % (
+            when, TIME_SOURCES.get(source, source), names, offset, readings, brightness, failed)
+
+    if packet_type == TELEMETRY_POSITION:
+        raw_lat, raw_lon, lat, lon, alt = struct.unpack(POSITION_FORMAT, payload)
+        return "POSITION raw=%s,%s filtered=%s,%s alt=%.2fm" % (
+            format_degrees(raw_lat), format_degrees(raw_lon), format_degrees(lat), format_degrees(lon), alt / 100.0)
+
+    if packet_type == TELEMETRY_HEALTH:
+        uptime, received, dropped, overflows, high_water, misses = struct.unpack(HEALTH_FORMAT, payload)
+        return "HEALTH uptime=%.1fs rx=%d dropped=%d overflows=%d high-water=%d deadline-misses=%d" % (
+            uptime / 1000.0, received, dropped, overflows, high_water, misses)
+
+    return "UNKNOWN type=0x%02x payload=%s" % (packet_type, payload.hex())
+
+
+class Decoder:
+    """Splits the byte stream into frames and tracks lost packets."""
+
+    def __init__(self, output):
+        self.output = output
+        self.buffer = bytearray()
+        self.expected_sequence = None
+        self.lost = 0
+        self.errors = 0
+
+    def feed(self, data):
+        for byte in data:
+            if byte != 0:
+                self.buffer.append(byte)
+                continue
+            if self.buffer:
+                self.handle_frame(bytes(self.buffer))
+            self.buffer.clear()
+
+    def handle_frame(self, frame):
+        try:
+            packet = cobs_decode(unescape(frame))
+            if len(packet) < 3 or crc8(packet[:-1]) != packet[-1]:
+                raise ValueError("bad CRC")
+            line = format_packet(packet[0], packet[2:-1])
+        except (ValueError, struct.error):
+            # Text (e.g. a serial command reply) runs into the next frame
+            # until its delimiter: print the text, then retry the rest
+            newline = frame.rfind(b"\n")
+            if 0 <= newline < len(frame) - 1:
+                self.handle_text(frame[:newline + 1])
+                self.handle_frame(frame[newline + 1:])
+            else:
+                self.handle_text(frame)
+            return
+
+        sequence = packet[1]
+        if self.expected_sequence is not None and sequence != self.expected_sequence:
+            self.lost += (sequence - self.expected_sequence) & 0xFF
+            line += "  (lost %d so far)" % self.lost
+        self.expected_sequence = (sequence + 1) & 0xFF
+        self.output.write("#%03d %s\n" % (sequence, line))
+        self.output.flush()
+
+    def handle_text(self, frame):
+        text = frame.decode("ascii", errors="replace")
+        printable = "".join(char for char in text if char.isprintable() or char in "\r\n")
+        if len(printable) >= len(text) * 3 // 4:
+            for line in printable.splitlines():
+                if line.strip():
+                    self.output.write("TEXT %s\n" % line.strip())
+        else:
+            self.errors += 1
+            self.output.write("ERROR undecodable frame (%d so far)\n" % self.errors)
+        self.output.flush()
+
+
+def open_source(path, baud):
+    try:
+        return open(path, "rb", buffering=0) if not path.startswith(("/dev/", "COM")) else open_serial(path, baud)
+    except OSError as error:
+        sys.exit("cannot open %s: %s" % (path, error))
+
+
+def open_serial(path, baud):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required to read from a serial port (pip install pyserial)")
+    return serial.Serial(path, baud, timeout=1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode GPS clock binary telemetry")
+    parser.add_argument("source", help="serial port (e.g. /dev/ttyUSB0, COM3) or capture file")
+    parser.add_argument("--baud", type=int, default=115200, help="serial baud rate (default: 115200, GPS_SERIAL_BAUD_RATE)")
+    args = parser.parse_args()
+
+    source = open_source(args.source, args.baud)
+    decoder = Decoder(sys.stdout)
+    try:
+        while True:
+            data = source.read(256)
+            if not data:
+                if hasattr(source, "in_waiting"):
+                    continue
+                break
+            decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()